@@ -39,19 +39,22 @@ int main(){
         safe<signed int>   a{-1};
         safe<unsigned int> b{1};
         std::cout << "a is " << a << " b is " << b << '\n';
+        // the values are compared without converting either of them so
+        // the result is that of the mathematical comparison
         if(a < b){
             std::cout << "a is less than b\n";
         }
         else{
             std::cout << "b is less than a\n";
+            std::cout << "wrong answer!" << std::endl;
+            return 1;
         }
-        std::cout << "error NOT detected!" << std::endl;
-        return 1;
+        std::cout << "correct answer!" << std::endl;
     }
     catch(const std::exception & e){
-        // never arrive here - just produce the correct answer!
+        // never arrive here - the comparison can't fail
         std::cout << e.what() << std::endl;
-        std::cout << "error detected!" << std::endl;
+        return 1;
     }
     return 0;
 }
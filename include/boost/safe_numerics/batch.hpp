@@ -0,0 +1,285 @@
+#ifndef BOOST_NUMERIC_BATCH_HPP
+#define BOOST_NUMERIC_BATCH_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// evaluation of an expression over columns of integers such as
+//
+//     out[i] = a[i] * b[i] + c[i]
+//
+// The columns are processed in blocks.  For each block, the expression is
+// first evaluated with interval arithmetic on the minimum and maximum
+// values of each column in the block (zone map statistics).  If this
+// proves that no intermediate or final result can overflow, the block is
+// evaluated with plain integer arithmetic which the compiler is free to
+// vectorize.  Otherwise, the block is evaluated with safe integers and
+// any error is handled according to the exception policy.
+//
+// The expression is passed as a generic function object which is invoked
+// with arguments of three different types:
+// a) interval<checked_result<W>> - to determine the range of the result
+// b) W - for the unchecked evaluation
+// c) safe<W, native, E> - for the checked evaluation
+// where W is the common type of the columns.  So the expression should
+// be composed of the operators +, - and * applied to its arguments.
+
+#include <algorithm> // min
+#include <cstddef>   // size_t
+#include <limits>
+#include <type_traits>
+#include <utility>   // pair
+
+#include "safe_integer.hpp"
+#include "checked_result.hpp"
+#include "checked_result_operations.hpp"
+#include "interval.hpp"
+#include "safe_compare.hpp"
+#include "exception_policies.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+// a column of values of type T which may be an integer or a safe integer.
+// The optional zone map holds the minimum and maximum values of each
+// block of the column.  If it is not provided, the statistics are
+// calculated from the data.
+template<class T>
+struct batch_column {
+    using value_type = typename base_type<T>::type;
+    const T * m_data;
+    const std::pair<value_type, value_type> * m_zone_map;
+};
+
+template<class T>
+constexpr batch_column<T> make_batch_column(
+    const T * data,
+    const std::pair<typename base_type<T>::type, typename base_type<T>::type>
+        * zone_map = nullptr
+){
+    return batch_column<T>{data, zone_map};
+}
+
+// counts of the blocks evaluated by each method
+struct batch_statistics {
+    std::size_t m_unchecked_blocks;
+    std::size_t m_checked_blocks;
+};
+
+// the default number of elements in each block
+constexpr const std::size_t batch_block_size = 1024;
+
+// the minimum and maximum values of the n elements starting at first
+template<class T>
+std::pair<typename base_type<T>::type, typename base_type<T>::type>
+block_bounds(const T * first, const std::size_t & n){
+    using value_type = typename base_type<T>::type;
+    // written without branches and with independent accumulators so
+    // the compiler can vectorize or at least pipeline it
+    constexpr const std::size_t lanes = 4;
+    value_type l[lanes], u[lanes];
+    for(std::size_t j = 0; j < lanes; ++j)
+        l[j] = u[j] = base_value(first[0]);
+    std::size_t i = 0;
+    for(; i + lanes <= n; i += lanes){
+        for(std::size_t j = 0; j < lanes; ++j){
+            const value_type x = base_value(first[i + j]);
+            l[j] = x < l[j] ? x : l[j];
+            u[j] = u[j] < x ? x : u[j];
+        }
+    }
+    for(; i < n; ++i){
+        const value_type x = base_value(first[i]);
+        l[0] = x < l[0] ? x : l[0];
+        u[0] = u[0] < x ? x : u[0];
+    }
+    for(std::size_t j = 1; j < lanes; ++j){
+        l[0] = l[j] < l[0] ? l[j] : l[0];
+        u[0] = u[0] < u[j] ? u[j] : u[0];
+    }
+    return std::pair<value_type, value_type>(l[0], u[0]);
+}
+
+// calculate the zone map for a column of n elements.  zone_map must have
+// room for (n + block_size - 1) / block_size entries
+template<class T>
+void make_zone_map(
+    const T * first,
+    const std::size_t & n,
+    std::pair<typename base_type<T>::type, typename base_type<T>::type>
+        * zone_map,
+    const std::size_t & block_size = batch_block_size
+){
+    for(std::size_t i = 0; i < n; i += block_size)
+        *zone_map++ = block_bounds(first + i, std::min(block_size, n - i));
+}
+
+// return true if evaluating f on arguments in the given ranges is
+// guaranteed to produce a result of type R without error
+template<class R, class W, class F, class ... S>
+bool batch_fits(F & f, const std::pair<S, S> & ... bounds){
+    using r_type = checked_result<W>;
+    const interval<r_type> r = f(
+        interval<r_type>(
+            r_type(static_cast<W>(bounds.first)),
+            r_type(static_cast<W>(bounds.second))
+        ) ...
+    );
+    if(r.l.exception() || r.u.exception())
+        return false;
+    return
+        safe_compare::greater_than_equal(
+            static_cast<W>(r.l),
+            base_value(std::numeric_limits<R>::min())
+        )
+        && safe_compare::less_than_equal(
+            static_cast<W>(r.u),
+            base_value(std::numeric_limits<R>::max())
+        );
+}
+
+namespace batch_detail {
+
+// store a value which is known to be in range
+template<class R, class T>
+constexpr typename std::enable_if<! is_safe<R>::value, R>::type
+make_result(const T & t){
+    return static_cast<R>(t);
+}
+template<class R, class T>
+constexpr typename std::enable_if<is_safe<R>::value, R>::type
+make_result(const T & t){
+    return R(
+        static_cast<typename base_type<R>::type>(t),
+        typename R::skip_validation()
+    );
+}
+
+template<class W, class R, class F, class ... T>
+void unchecked_block(
+    F & f,
+    const std::size_t first,
+    const std::size_t last,
+    R * out,
+    const batch_column<T> & ... columns
+){
+    for(std::size_t i = first; i < last; ++i)
+        out[i] = make_result<R>(
+            f(static_cast<W>(base_value(columns.m_data[i])) ...)
+        );
+}
+
+template<class E, class W, class R, class F, class ... T>
+void checked_block(
+    F & f,
+    const std::size_t first,
+    const std::size_t last,
+    R * out,
+    const batch_column<T> & ... columns
+){
+    using safe_w = safe<W, native, E>;
+    using safe_r = safe<typename base_type<R>::type, native, E>;
+    for(std::size_t i = first; i < last; ++i){
+        // conversion to safe_r checks that the result can be stored
+        const safe_r r(
+            f(safe_w(static_cast<W>(base_value(columns.m_data[i]))) ...)
+        );
+        out[i] = make_result<R>(base_value(r));
+    }
+}
+
+template<class T>
+std::pair<typename base_type<T>::type, typename base_type<T>::type>
+column_bounds(
+    const batch_column<T> & c,
+    const std::size_t & block,
+    const std::size_t & first,
+    const std::size_t & n
+){
+    return c.m_zone_map == nullptr
+        ? block_bounds(c.m_data + first, n)
+        : c.m_zone_map[block];
+}
+
+} // batch_detail
+
+// set out[i] = f(columns[i] ...) for i in [0, n).  R may be an integer or
+// a safe integer type.  Any zone maps must have been made with the same
+// block size.
+template<
+    class E = default_exception_policy,
+    class F,
+    class R,
+    class ... T
+>
+batch_statistics batch_evaluate(
+    F f,
+    const std::size_t & n,
+    const std::size_t & block_size,
+    R * out,
+    const batch_column<T> & ... columns
+){
+    using W = typename std::common_type<typename base_type<T>::type ...>::type;
+    static_assert(
+        std::is_integral<W>::value,
+        "batch evaluation is only implemented for integers"
+    );
+    batch_statistics s{0, 0};
+    std::size_t block = 0;
+    for(std::size_t first = 0; first < n; first += block_size, ++block){
+        const std::size_t m = std::min(block_size, n - first);
+        if(batch_fits<R, W>(
+            f,
+            batch_detail::column_bounds(columns, block, first, m) ...
+        )){
+            batch_detail::unchecked_block<W>(f, first, first + m, out, columns ...);
+            ++s.m_unchecked_blocks;
+        }
+        else{
+            batch_detail::checked_block<E, W>(f, first, first + m, out, columns ...);
+            ++s.m_checked_blocks;
+        }
+    }
+    return s;
+}
+
+template<
+    class E = default_exception_policy,
+    class F,
+    class R,
+    class ... T
+>
+batch_statistics batch_evaluate(
+    F f,
+    const std::size_t & n,
+    R * out,
+    const batch_column<T> & ... columns
+){
+    return batch_evaluate<E>(f, n, batch_block_size, out, columns ...);
+}
+
+// overload for columns without zone maps
+template<
+    class E = default_exception_policy,
+    class F,
+    class R,
+    class ... T
+>
+batch_statistics batch_evaluate(
+    F f,
+    const std::size_t & n,
+    R * out,
+    const T * ... columns
+){
+    return batch_evaluate<E>(
+        f, n, batch_block_size, out, make_batch_column(columns) ...
+    );
+}
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_BATCH_HPP
@@ -142,14 +142,20 @@ struct heterogeneous_checked_operation<
         }
     }; // cast_impl_detail
 
+    // the usual case of a value in range is a single comparison.  Only
+    // if it fails is the value compared with each bound to determine the
+    // error.
     constexpr static checked_result<R>
     cast(const T & t){
         return
-            cast_impl_detail::cast_impl(
-                t,
-                std::is_signed<R>(),
-                std::is_signed<T>()
-            );
+            boost::safe_numerics::safe_compare::in_range(t, Min, Max) ?
+                checked_result<R>(static_cast<R>(t))
+            :
+                cast_impl_detail::cast_impl(
+                    t,
+                    std::is_signed<R>(),
+                    std::is_signed<T>()
+                );
     }
 }; // heterogeneous_checked_operation
 
@@ -97,24 +97,76 @@ struct sum_value_type {
     }
 };
 
-// integers addition
-template<class T>
-typename std::enable_if<
-    std::is_integral<T>::value,
-    checked_result<T>
->::type
-constexpr inline operator+(
-    const checked_result<T> & t,
-    const checked_result<T> & u
-){
-    using value_type = sum_value_type;
-    const std::uint8_t order = static_cast<std::uint8_t>(value_type::count);
+struct product_value_type {
+    // characterization of various values
+    const enum flag {
+        less_than_min = 0,
+        less_than_zero,
+        zero,
+        greater_than_zero,
+        greater_than_max,
+        indeterminate,
+        // count of number of cases for values
+        count,
+        // temporary values for special cases
+        t_value,
+        u_value,
+        z_value
+    } m_flag;
+    template<class T>
+    constexpr flag to_flag(const checked_result<T> & t) const {
+        switch(static_cast<safe_numerics_error>(t)){
+        case safe_numerics_error::success:
+            return (t < checked_result<T>(0))
+                ? less_than_zero
+                : (t > checked_result<T>(0))
+                ? greater_than_zero
+                : zero;
+        case safe_numerics_error::negative_overflow_error:
+            // result is below representational minimum
+            return less_than_min;
+        case safe_numerics_error::positive_overflow_error:
+            // result is above representational maximum
+            return greater_than_max;
+        default:
+            return indeterminate;
+        }
+    }
+    template<class T>
+    constexpr product_value_type(const checked_result<T> & t) :
+        m_flag(to_flag(t))
+    {}
+    constexpr operator std::uint8_t () const {
+        return static_cast<std::uint8_t>(m_flag);
+    }
+};
+
+// the results of comparisons of extended integers.  runtime means that
+// both values are known and must be compared.
+enum class comparison_result : std::uint8_t {
+    runtime,
+    false_value,
+    true_value,
+    indeterminate,
+};
+
+// the tables which define the operations on extended integers.  These
+// are static members rather than local to each operator so that they are
+// defined once rather than built each time an operator is invoked.  Since
+// C++14 has no inline variables, a class template is used so that they
+// can be defined in this header.
+template<class Dummy = void>
+struct extended_integer_tables {
+    constexpr static const std::uint8_t sum_order =
+        static_cast<std::uint8_t>(sum_value_type::count);
+    constexpr static const std::uint8_t product_order =
+        static_cast<std::uint8_t>(product_value_type::count);
 
     // note major pain.  Clang constexpr multi-dimensional array is fine.
     // but gcc doesn't permit a multi-dimensional array to be be constexpr.
-    // so we need to some ugly gymnastics to make our system work for all
-    // all systems.
-    const enum safe_numerics_error result[order * order] = {
+    // so the tables are indexed by t * order + u
+
+    constexpr static const safe_numerics_error addition[sum_order * sum_order] = {
         // t == known_value
         //{
             // u == ...
@@ -149,41 +201,7 @@ constexpr inline operator+(
         //},
     };
 
-    const value_type tx(t);
-    const value_type ux(u);
-
-    const safe_numerics_error e = result[tx * order + ux];
-    if(safe_numerics_error::success == e)
-        return checked::add<T>(t, u);
-    return checked_result<T>(e, "addition result");
-}
-
-// unary +
-template<class T>
-typename std::enable_if<
-    std::is_integral<T>::value,
-    checked_result<T>
->::type
-constexpr inline operator+(
-    const checked_result<T> & t
-){
-    return t;
-}
-
-// integers subtraction
-template<class T>
-typename std::enable_if<
-    std::is_integral<T>::value,
-    checked_result<T>
->::type
-constexpr inline operator-(
-    const checked_result<T> & t,
-    const checked_result<T> & u
-){
-    using value_type = sum_value_type;
-    constexpr const std::uint8_t order = static_cast<std::uint8_t>(value_type::count);
-
-    constexpr const enum safe_numerics_error result[order * order] = {
+    constexpr static const safe_numerics_error subtraction[sum_order * sum_order] = {
         // t == known_value
         //{
             // u == ...
@@ -218,10 +236,345 @@ constexpr inline operator-(
         //},
     };
 
+    constexpr static const product_value_type::flag multiplication[product_order * product_order] = {
+        // t == less_than_min
+        //{
+            // u == ...
+            product_value_type::greater_than_max,   // less_than_min,
+            product_value_type::greater_than_max,   // less_than_zero,
+            product_value_type::zero,               // zero,
+            product_value_type::less_than_min,      // greater_than_zero,
+            product_value_type::less_than_min,      // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //},
+        // t == less_than_zero,
+        //{
+            // u == ...
+            product_value_type::greater_than_max,   // less_than_min,
+            product_value_type::greater_than_zero,  // less_than_zero,
+            product_value_type::zero,               // zero,
+            product_value_type::less_than_zero,     // greater_than_zero,
+            product_value_type::less_than_min,      // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //},
+        // t == zero,
+        //{
+            // u == ...
+            product_value_type::zero,               // less_than_min,
+            product_value_type::zero,               // less_than_zero,
+            product_value_type::zero,               // zero,
+            product_value_type::zero,               // greater_than_zero,
+            product_value_type::zero,               // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //},
+        // t == greater_than_zero,
+        //{
+            // u == ...
+            product_value_type::less_than_min,      // less_than_min,
+            product_value_type::less_than_zero,     // less_than_zero,
+            product_value_type::zero,               // zero,
+            product_value_type::greater_than_zero,  // greater_than_zero,
+            product_value_type::greater_than_max,   // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //},
+        // t == greater_than_max
+        //{
+            product_value_type::less_than_min,      // less_than_min,
+            product_value_type::less_than_min,      // less_than_zero,
+            product_value_type::zero,               // zero,
+            product_value_type::greater_than_max,   // greater_than_zero,
+            product_value_type::greater_than_max,   // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //},
+        // t == indeterminate
+        //{
+            product_value_type::indeterminate,      // less_than_min,
+            product_value_type::indeterminate,      // less_than_zero,
+            product_value_type::indeterminate,      // zero,
+            product_value_type::indeterminate,      // greater_than_zero,
+            product_value_type::indeterminate,      // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //}
+    };
+
+    constexpr static const product_value_type::flag division[product_order * product_order] = {
+        // t == less_than_min
+        //{
+            // u == ...
+            product_value_type::indeterminate,   // less_than_min,
+            product_value_type::greater_than_max,   // less_than_zero,
+            product_value_type::less_than_min,      // zero,
+            product_value_type::less_than_min,      // greater_than_zero,
+            product_value_type::less_than_min,      // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //},
+        // t == less_than_zero,
+        //{
+            // u == ...
+            product_value_type::zero,               // less_than_min,
+            product_value_type::greater_than_zero,  // less_than_zero,
+            product_value_type::less_than_min,      // zero,
+            product_value_type::less_than_zero,     // greater_than_zero,
+            product_value_type::zero,               // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //},
+        // t == zero,
+        //{
+            // u == ...
+            product_value_type::zero,               // less_than_min,
+            product_value_type::zero,               // less_than_zero,
+            product_value_type::indeterminate,      // zero,
+            product_value_type::zero,               // greater_than_zero,
+            product_value_type::zero,               // greater than max,
+            product_value_type::indeterminate,               // indeterminate,
+        //},
+        // t == greater_than_zero,
+        //{
+            // u == ...
+            product_value_type::zero,               // less_than_min,
+            product_value_type::less_than_zero,     // less_than_zero,
+            product_value_type::greater_than_max,   // zero,
+            product_value_type::greater_than_zero,  // greater_than_zero,
+            product_value_type::zero,               // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //},
+        // t == greater_than_max
+        //{
+            product_value_type::less_than_min,      // less_than_min,
+            product_value_type::less_than_min,      // less_than_zero,
+            product_value_type::greater_than_max,   // zero,
+            product_value_type::greater_than_max,   // greater_than_zero,
+            product_value_type::indeterminate,   // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //},
+        // t == indeterminate
+        //{
+            product_value_type::indeterminate,      // less_than_min,
+            product_value_type::indeterminate,      // less_than_zero,
+            product_value_type::indeterminate,      // zero,
+            product_value_type::indeterminate,      // greater_than_zero,
+            product_value_type::indeterminate,      // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //}
+    };
+
+    constexpr static const product_value_type::flag modulus[product_order * product_order] = {
+        // t == less_than_min
+        //{
+            // u == ...
+            product_value_type::indeterminate,      // less_than_min,
+            product_value_type::z_value,            // less_than_zero,
+            product_value_type::indeterminate,      // zero,
+            product_value_type::z_value,            // greater_than_zero,
+            product_value_type::indeterminate,      // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //},
+        // t == less_than_zero,
+        //{
+            // u == ...
+            product_value_type::t_value,            // less_than_min,
+            product_value_type::greater_than_zero,  // less_than_zero,
+            product_value_type::indeterminate,      // zero,
+            product_value_type::less_than_zero,     // greater_than_zero,
+            product_value_type::t_value,            // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //},
+        // t == zero,
+        //{
+            // u == ...
+            product_value_type::zero,               // less_than_min,
+            product_value_type::zero,               // less_than_zero,
+            product_value_type::indeterminate,      // zero,
+            product_value_type::zero,               // greater_than_zero,
+            product_value_type::zero,               // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //},
+        // t == greater_than_zero,
+        //{
+            // u == ...
+            product_value_type::t_value,            // less_than_min,
+            product_value_type::less_than_zero,     // less_than_zero,
+            product_value_type::indeterminate,      // zero,
+            product_value_type::greater_than_zero,  // greater_than_zero,
+            product_value_type::t_value,            // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //},
+        // t == greater_than_max
+        //{
+            product_value_type::indeterminate,      // less_than_min,
+            product_value_type::u_value,            // less_than_zero,
+            product_value_type::indeterminate,      // zero,
+            product_value_type::u_value,            // greater_than_zero,
+            product_value_type::indeterminate,      // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //},
+        // t == indeterminate
+        //{
+            product_value_type::indeterminate,      // less_than_min,
+            product_value_type::indeterminate,      // less_than_zero,
+            product_value_type::indeterminate,      // zero,
+            product_value_type::indeterminate,      // greater_than_zero,
+            product_value_type::indeterminate,      // greater than max,
+            product_value_type::indeterminate,      // indeterminate,
+        //}
+    };
+
+    // the question arises about how to order values of type greater_than_min.
+    // that is: what should greater_than_min < greater_than_min return.
+    //
+    // a) return indeterminate because we're talking about the "true" values for
+    //    which greater_than_min is a placholder.
+    //
+    // b) return false because the two values are "equal"
+    //
+    // for our purposes, a) seems the better interpretation.
+    constexpr static const comparison_result less_than[sum_order * sum_order] = {
+        // t == known_value
+        //{
+            // u == ...
+            comparison_result::runtime,       // known_value,
+            comparison_result::false_value,   // less_than_min,
+            comparison_result::true_value,    // greater_than_max,
+            comparison_result::indeterminate, // indeterminate,
+        //},
+        // t == less_than_min
+        //{
+            // u == ...
+            comparison_result::true_value,    // known_value,
+            comparison_result::indeterminate, // less_than_min, see above argument
+            comparison_result::true_value,    // greater_than_max,
+            comparison_result::indeterminate, // indeterminate,
+        //},
+        // t == greater_than_max
+        //{
+            // u == ...
+            comparison_result::false_value,   // known_value,
+            comparison_result::false_value,   // less_than_min,
+            comparison_result::indeterminate, // greater_than_max, see above argument
+            comparison_result::indeterminate, // indeterminate,
+        //},
+        // t == indeterminate
+        //{
+            // u == ...
+            comparison_result::indeterminate, // known_value,
+            comparison_result::indeterminate, // less_than_min,
+            comparison_result::indeterminate, // greater_than_max,
+            comparison_result::indeterminate, // indeterminate,
+        //},
+    };
+
+    constexpr static const comparison_result equal[sum_order * sum_order] = {
+        // t == known_value
+        //{
+            // u == ...
+            comparison_result::runtime,       // known_value,
+            comparison_result::false_value,   // less_than_min,
+            comparison_result::false_value,   // greater_than_max,
+            comparison_result::indeterminate, // indeterminate,
+        //},
+        // t == less_than_min
+        //{
+            // u == ...
+            comparison_result::false_value,   // known_value,
+            comparison_result::indeterminate, // less_than_min,
+            comparison_result::false_value,   // greater_than_max,
+            comparison_result::indeterminate, // indeterminate,
+        //},
+        // t == greater_than_max
+        //{
+            // u == ...
+            comparison_result::false_value,   // known_value,
+            comparison_result::false_value,   // less_than_min,
+            comparison_result::indeterminate, // greater_than_max,
+            comparison_result::indeterminate, // indeterminate,
+        //},
+        // t == indeterminate
+        //{
+            // u == ...
+            comparison_result::indeterminate, // known_value,
+            comparison_result::indeterminate, // less_than_min,
+            comparison_result::indeterminate, // greater_than_max,
+            comparison_result::indeterminate, // indeterminate,
+        //},
+    };
+};
+
+template<class Dummy>
+constexpr const safe_numerics_error extended_integer_tables<Dummy>::addition[];
+template<class Dummy>
+constexpr const safe_numerics_error extended_integer_tables<Dummy>::subtraction[];
+template<class Dummy>
+constexpr const product_value_type::flag extended_integer_tables<Dummy>::multiplication[];
+template<class Dummy>
+constexpr const product_value_type::flag extended_integer_tables<Dummy>::division[];
+template<class Dummy>
+constexpr const product_value_type::flag extended_integer_tables<Dummy>::modulus[];
+template<class Dummy>
+constexpr const comparison_result extended_integer_tables<Dummy>::less_than[];
+template<class Dummy>
+constexpr const comparison_result extended_integer_tables<Dummy>::equal[];
+
+// integers addition
+template<class T>
+typename std::enable_if<
+    std::is_integral<T>::value,
+    checked_result<T>
+>::type
+constexpr inline operator+(
+    const checked_result<T> & t,
+    const checked_result<T> & u
+){
+    // the common case of two values first
+    if(t.m_e == safe_numerics_error::success
+    && u.m_e == safe_numerics_error::success)
+        return checked::add<T>(t, u);
+
+    using value_type = sum_value_type;
+    using tables = extended_integer_tables<>;
+
+    const value_type tx(t);
+    const value_type ux(u);
+
+    const safe_numerics_error e = tables::addition[tx * tables::sum_order + ux];
+    if(safe_numerics_error::success == e)
+        return checked::add<T>(t, u);
+    return checked_result<T>(e, "addition result");
+}
+
+// unary +
+template<class T>
+typename std::enable_if<
+    std::is_integral<T>::value,
+    checked_result<T>
+>::type
+constexpr inline operator+(
+    const checked_result<T> & t
+){
+    return t;
+}
+
+// integers subtraction
+template<class T>
+typename std::enable_if<
+    std::is_integral<T>::value,
+    checked_result<T>
+>::type
+constexpr inline operator-(
+    const checked_result<T> & t,
+    const checked_result<T> & u
+){
+    // the common case of two values first
+    if(t.m_e == safe_numerics_error::success
+    && u.m_e == safe_numerics_error::success)
+        return checked::subtract<T>(t, u);
+
+    using value_type = sum_value_type;
+    using tables = extended_integer_tables<>;
+
     const value_type tx(t);
     const value_type ux(u);
 
-    const safe_numerics_error e = result[tx * order + ux];
+    const safe_numerics_error e = tables::subtraction[tx * tables::sum_order + ux];
     if(safe_numerics_error::success == e)
         return checked::subtract<T>(t, u);
     return checked_result<T>(e, "subtraction result");
@@ -240,49 +593,6 @@ constexpr inline operator-(
     return checked_result<T>(0) - t;
 }
 
-struct product_value_type {
-    // characterization of various values
-    const enum flag {
-        less_than_min = 0,
-        less_than_zero,
-        zero,
-        greater_than_zero,
-        greater_than_max,
-        indeterminate,
-        // count of number of cases for values
-        count,
-        // temporary values for special cases
-        t_value,
-        u_value,
-        z_value
-    } m_flag;
-    template<class T>
-    constexpr flag to_flag(const checked_result<T> & t) const {
-        switch(static_cast<safe_numerics_error>(t)){
-        case safe_numerics_error::success:
-            return (t < checked_result<T>(0))
-                ? less_than_zero
-                : (t > checked_result<T>(0))
-                ? greater_than_zero
-                : zero;
-        case safe_numerics_error::negative_overflow_error:
-            // result is below representational minimum
-            return less_than_min;
-        case safe_numerics_error::positive_overflow_error:
-            // result is above representational maximum
-            return greater_than_max;
-        default:
-            return indeterminate;
-        }
-    }
-    template<class T>
-    constexpr product_value_type(const checked_result<T> & t) :
-        m_flag(to_flag(t))
-    {}
-    constexpr operator std::uint8_t () const {
-        return static_cast<std::uint8_t>(m_flag);
-    }
-};
 
 // integers multiplication
 template<class T>
@@ -294,74 +604,18 @@ constexpr inline operator*(
     const checked_result<T> & t,
     const checked_result<T> & u
 ){
-    using value_type = product_value_type;
-    const std::uint8_t order = static_cast<std::uint8_t>(value_type::count);
+    // the common case of two values first
+    if(t.m_e == safe_numerics_error::success
+    && u.m_e == safe_numerics_error::success)
+        return checked::multiply<T>(t, u);
 
-    constexpr const enum value_type::flag result[order * order] = {
-        // t == less_than_min
-        //{
-            // u == ...
-            value_type::greater_than_max,   // less_than_min,
-            value_type::greater_than_max,   // less_than_zero,
-            value_type::zero,               // zero,
-            value_type::less_than_min,      // greater_than_zero,
-            value_type::less_than_min,      // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //},
-        // t == less_than_zero,
-        //{
-            // u == ...
-            value_type::greater_than_max,   // less_than_min,
-            value_type::greater_than_zero,  // less_than_zero,
-            value_type::zero,               // zero,
-            value_type::less_than_zero,     // greater_than_zero,
-            value_type::less_than_min,      // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //},
-        // t == zero,
-        //{
-            // u == ...
-            value_type::zero,               // less_than_min,
-            value_type::zero,               // less_than_zero,
-            value_type::zero,               // zero,
-            value_type::zero,               // greater_than_zero,
-            value_type::zero,               // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //},
-        // t == greater_than_zero,
-        //{
-            // u == ...
-            value_type::less_than_min,      // less_than_min,
-            value_type::less_than_zero,     // less_than_zero,
-            value_type::zero,               // zero,
-            value_type::greater_than_zero,  // greater_than_zero,
-            value_type::greater_than_max,   // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //},
-        // t == greater_than_max
-        //{
-            value_type::less_than_min,      // less_than_min,
-            value_type::less_than_min,      // less_than_zero,
-            value_type::zero,               // zero,
-            value_type::greater_than_max,   // greater_than_zero,
-            value_type::greater_than_max,   // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //},
-        // t == indeterminate
-        //{
-            value_type::indeterminate,      // less_than_min,
-            value_type::indeterminate,      // less_than_zero,
-            value_type::indeterminate,      // zero,
-            value_type::indeterminate,      // greater_than_zero,
-            value_type::indeterminate,      // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //}
-    };
+    using value_type = product_value_type;
+    using tables = extended_integer_tables<>;
 
     const value_type tx(t);
     const value_type ux(u);
 
-    switch(result[tx * order + ux]){
+    switch(tables::multiplication[tx * tables::product_order + ux]){
         case value_type::less_than_min:
             return safe_numerics_error::negative_overflow_error;
         case value_type::zero:
@@ -389,74 +643,19 @@ constexpr inline operator/(
     const checked_result<T> & t,
     const checked_result<T> & u
 ){
-    using value_type = product_value_type;
-    const std::uint8_t order = static_cast<std::uint8_t>(value_type::count);
+    // the common case of two values with a non zero divisor first
+    if(t.m_e == safe_numerics_error::success
+    && u.m_e == safe_numerics_error::success
+    && static_cast<const T &>(u) != 0)
+        return checked::divide<T>(t, u);
 
-    constexpr const enum value_type::flag result[order * order] = {
-        // t == less_than_min
-        //{
-            // u == ...
-            value_type::indeterminate,   // less_than_min,
-            value_type::greater_than_max,   // less_than_zero,
-            value_type::less_than_min,      // zero,
-            value_type::less_than_min,      // greater_than_zero,
-            value_type::less_than_min,      // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //},
-        // t == less_than_zero,
-        //{
-            // u == ...
-            value_type::zero,               // less_than_min,
-            value_type::greater_than_zero,  // less_than_zero,
-            value_type::less_than_min,      // zero,
-            value_type::less_than_zero,     // greater_than_zero,
-            value_type::zero,               // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //},
-        // t == zero,
-        //{
-            // u == ...
-            value_type::zero,               // less_than_min,
-            value_type::zero,               // less_than_zero,
-            value_type::indeterminate,      // zero,
-            value_type::zero,               // greater_than_zero,
-            value_type::zero,               // greater than max,
-            value_type::indeterminate,               // indeterminate,
-        //},
-        // t == greater_than_zero,
-        //{
-            // u == ...
-            value_type::zero,               // less_than_min,
-            value_type::less_than_zero,     // less_than_zero,
-            value_type::greater_than_max,   // zero,
-            value_type::greater_than_zero,  // greater_than_zero,
-            value_type::zero,               // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //},
-        // t == greater_than_max
-        //{
-            value_type::less_than_min,      // less_than_min,
-            value_type::less_than_min,      // less_than_zero,
-            value_type::greater_than_max,   // zero,
-            value_type::greater_than_max,   // greater_than_zero,
-            value_type::indeterminate,   // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //},
-        // t == indeterminate
-        //{
-            value_type::indeterminate,      // less_than_min,
-            value_type::indeterminate,      // less_than_zero,
-            value_type::indeterminate,      // zero,
-            value_type::indeterminate,      // greater_than_zero,
-            value_type::indeterminate,      // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //}
-    };
+    using value_type = product_value_type;
+    using tables = extended_integer_tables<>;
 
     const value_type tx(t);
     const value_type ux(u);
 
-    switch(result[tx * order + ux]){
+    switch(tables::division[tx * tables::product_order + ux]){
         case value_type::less_than_min:
             return safe_numerics_error::negative_overflow_error;
         case value_type::zero:
@@ -484,74 +683,19 @@ constexpr inline operator%(
     const checked_result<T> & t,
     const checked_result<T> & u
 ){
-    using value_type = product_value_type;
-    const std::uint8_t order = static_cast<std::uint8_t>(value_type::count);
+    // the common case of two values with a non zero divisor first
+    if(t.m_e == safe_numerics_error::success
+    && u.m_e == safe_numerics_error::success
+    && static_cast<const T &>(u) != 0)
+        return checked::modulus<T>(t, u);
 
-    constexpr const enum value_type::flag result[order * order] = {
-        // t == less_than_min
-        //{
-            // u == ...
-            value_type::indeterminate,      // less_than_min,
-            value_type::z_value,            // less_than_zero,
-            value_type::indeterminate,      // zero,
-            value_type::z_value,            // greater_than_zero,
-            value_type::indeterminate,      // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //},
-        // t == less_than_zero,
-        //{
-            // u == ...
-            value_type::t_value,            // less_than_min,
-            value_type::greater_than_zero,  // less_than_zero,
-            value_type::indeterminate,      // zero,
-            value_type::less_than_zero,     // greater_than_zero,
-            value_type::t_value,            // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //},
-        // t == zero,
-        //{
-            // u == ...
-            value_type::zero,               // less_than_min,
-            value_type::zero,               // less_than_zero,
-            value_type::indeterminate,      // zero,
-            value_type::zero,               // greater_than_zero,
-            value_type::zero,               // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //},
-        // t == greater_than_zero,
-        //{
-            // u == ...
-            value_type::t_value,            // less_than_min,
-            value_type::less_than_zero,     // less_than_zero,
-            value_type::indeterminate,      // zero,
-            value_type::greater_than_zero,  // greater_than_zero,
-            value_type::t_value,            // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //},
-        // t == greater_than_max
-        //{
-            value_type::indeterminate,      // less_than_min,
-            value_type::u_value,            // less_than_zero,
-            value_type::indeterminate,      // zero,
-            value_type::u_value,            // greater_than_zero,
-            value_type::indeterminate,      // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //},
-        // t == indeterminate
-        //{
-            value_type::indeterminate,      // less_than_min,
-            value_type::indeterminate,      // less_than_zero,
-            value_type::indeterminate,      // zero,
-            value_type::indeterminate,      // greater_than_zero,
-            value_type::indeterminate,      // greater than max,
-            value_type::indeterminate,      // indeterminate,
-        //}
-    };
+    using value_type = product_value_type;
+    using tables = extended_integer_tables<>;
 
     const value_type tx(t);
     const value_type ux(u);
 
-    switch(result[tx * order + ux]){
+    switch(tables::modulus[tx * tables::product_order + ux]){
         case value_type::zero:
             return 0;
         case value_type::less_than_zero:
@@ -581,71 +725,25 @@ constexpr boost::logic::tribool operator<(
     const checked_result<T> & t,
     const checked_result<T> & u
 ){
-    using value_type = sum_value_type;
-    constexpr const std::uint8_t order = static_cast<std::uint8_t>(value_type::count);
+    // the common case of two values first
+    if(t.m_e == safe_numerics_error::success
+    && u.m_e == safe_numerics_error::success)
+        return static_cast<const T &>(t) < static_cast<const T &>(u);
 
-    // the question arises about how to order values of type greater_than_min.
-    // that is: what should greater_than_min < greater_than_min return.
-    //
-    // a) return indeterminate because we're talking about the "true" values for
-    //    which greater_than_min is a placholder.
-    //
-    // b) return false because the two values are "equal"
-    //
-    // for our purposes, a) seems the better interpretation.
-    
-    enum class result_type : std::uint8_t {
-        runtime,
-        false_value,
-        true_value,
-        indeterminate,
-    };
-    constexpr const result_type resultx[order * order]{
-        // t == known_value
-        //{
-            // u == ...
-            result_type::runtime,       // known_value,
-            result_type::false_value,   // less_than_min,
-            result_type::true_value,    // greater_than_max,
-            result_type::indeterminate, // indeterminate,
-        //},
-        // t == less_than_min
-        //{
-            // u == ...
-            result_type::true_value,    // known_value,
-            result_type::indeterminate, // less_than_min, see above argument
-            result_type::true_value,    // greater_than_max,
-            result_type::indeterminate, // indeterminate,
-        //},
-        // t == greater_than_max
-        //{
-            // u == ...
-            result_type::false_value,   // known_value,
-            result_type::false_value,   // less_than_min,
-            result_type::indeterminate, // greater_than_max, see above argument
-            result_type::indeterminate, // indeterminate,
-        //},
-        // t == indeterminate
-        //{
-            // u == ...
-            result_type::indeterminate, // known_value,
-            result_type::indeterminate, // less_than_min,
-            result_type::indeterminate, // greater_than_max,
-            result_type::indeterminate, // indeterminate,
-        //},
-    };
+    using value_type = sum_value_type;
+    using tables = extended_integer_tables<>;
 
     const value_type tx(t);
     const value_type ux(u);
 
-    switch(resultx[tx * order + ux]){
-    case result_type::runtime:
+    switch(tables::less_than[tx * tables::sum_order + ux]){
+    case comparison_result::runtime:
         return static_cast<const T &>(t) < static_cast<const T &>(u);
-    case result_type::false_value:
+    case comparison_result::false_value:
         return false;
-    case result_type::true_value:
+    case comparison_result::true_value:
         return true;
-    case result_type::indeterminate:
+    case comparison_result::indeterminate:
         return boost::logic::indeterminate;
     default:
         assert(false);
@@ -686,62 +784,25 @@ operator==(
     const checked_result<T> & t,
     const checked_result<T> & u
 ){
-    using value_type = sum_value_type;
-    constexpr const std::uint8_t order = static_cast<std::uint8_t>(value_type::count);
-
-    enum class result_type : std::uint8_t {
-        runtime,
-        false_value,
-        true_value,
-        indeterminate,
-    };
+    // the common case of two values first
+    if(t.m_e == safe_numerics_error::success
+    && u.m_e == safe_numerics_error::success)
+        return static_cast<const T &>(t) == static_cast<const T &>(u);
 
-    constexpr const result_type result[order * order]{
-        // t == known_value
-        //{
-            // u == ...
-            result_type::runtime,       // known_value,
-            result_type::false_value,   // less_than_min,
-            result_type::false_value,   // greater_than_max,
-            result_type::indeterminate, // indeterminate,
-        //},
-        // t == less_than_min
-        //{
-            // u == ...
-            result_type::false_value,   // known_value,
-            result_type::indeterminate, // less_than_min,
-            result_type::false_value,   // greater_than_max,
-            result_type::indeterminate, // indeterminate,
-        //},
-        // t == greater_than_max
-        //{
-            // u == ...
-            result_type::false_value,   // known_value,
-            result_type::false_value,   // less_than_min,
-            result_type::indeterminate, // greater_than_max,
-            result_type::indeterminate, // indeterminate,
-        //},
-        // t == indeterminate
-        //{
-            // u == ...
-            result_type::indeterminate, // known_value,
-            result_type::indeterminate, // less_than_min,
-            result_type::indeterminate, // greater_than_max,
-            result_type::indeterminate, // indeterminate,
-        //},
-    };
+    using value_type = sum_value_type;
+    using tables = extended_integer_tables<>;
 
     const value_type tx(t);
     const value_type ux(u);
 
-    switch(result[tx * order + ux]){
-    case result_type::runtime:
+    switch(tables::equal[tx * tables::sum_order + ux]){
+    case comparison_result::runtime:
         return static_cast<const T &>(t) == static_cast<const T &>(u);
-    case result_type::false_value:
+    case comparison_result::false_value:
         return false;
-    case result_type::true_value:
+    case comparison_result::true_value:
         return true;
-    case result_type::indeterminate:
+    case comparison_result::indeterminate:
         return boost::logic::indeterminate;
     default:
         assert(false);
@@ -8,8 +8,10 @@
 // http://www.boost.org/LICENSE_1_0.txt)
 
 #include <boost/mp11.hpp>
-#include <boost/config.hpp> // BOOST_NO_EXCEPTIONS
+#include <boost/config.hpp> // BOOST_NO_EXCEPTIONS, BOOST_NORETURN
+#include <cstdlib> // abort
 #include "exception.hpp"
+#include "checked_result.hpp" // dispatch_and_return
 
 namespace boost {
 namespace safe_numerics {
@@ -81,6 +83,85 @@ struct throw_exception {
     #endif
 };
 
+// record the first error detected on this thread and continue as
+// ignore_exception does.  Code which must not throw can clear the record,
+// perform a sequence of operations and then check whether any failed.
+struct sticky_exception {
+    constexpr sticky_exception() = default;
+    void operator()(
+        const safe_numerics_error & e,
+        const char *
+    ){
+        safe_numerics_error & s = state();
+        if(s == safe_numerics_error::success)
+            s = e;
+    }
+    static safe_numerics_error error(){
+        return state();
+    }
+    static void clear(){
+        state() = safe_numerics_error::success;
+    }
+private:
+    static safe_numerics_error & state(){
+        static thread_local safe_numerics_error e = safe_numerics_error::success;
+        return e;
+    }
+};
+
+// the error and the message of the check which executed a runtime trap.
+// The fields are written just before the trap so a debugger, a core dump
+// or a SIGILL handler can identify the check which failed.
+struct runtime_trap_context {
+    volatile safe_numerics_error error;
+    const char * volatile site;
+};
+
+inline runtime_trap_context & trap_context(){
+    static runtime_trap_context c = {safe_numerics_error::success, nullptr};
+    return c;
+}
+
+// terminate the program with a single trap instruction.  Nothing is
+// thrown so the checks need neither exception objects nor unwind tables.
+BOOST_NORETURN inline void runtime_trap(){
+    #if defined(__GNUC__) || defined(__clang__)
+    __builtin_trap();
+    #elif defined(_MSC_VER)
+    __debugbreak();
+    std::abort();
+    #else
+    std::abort();
+    #endif
+}
+
+// If an exceptional condition is detected at runtime execute a trap
+// instruction.
+struct runtime_trap_exception {
+    constexpr runtime_trap_exception() = default;
+    BOOST_NORETURN void operator()(
+        const safe_numerics_error &,
+        const char *
+    ){
+        runtime_trap();
+    }
+};
+
+// as above but first record the error and the message in trap_context().
+// This costs two stores per check.
+struct recorded_trap_exception {
+    constexpr recorded_trap_exception() = default;
+    BOOST_NORETURN void operator()(
+        const safe_numerics_error & e,
+        const char * message
+    ){
+        runtime_trap_context & c = trap_context();
+        c.error = e;
+        c.site = message;
+        runtime_trap();
+    }
+};
+
 // given an error code - return the action code which it corresponds to.
 constexpr inline safe_numerics_actions
 make_safe_numerics_action(const safe_numerics_error & e){
@@ -160,6 +241,31 @@ dispatch(const char * msg){
     dispatch_switch::dispatch_case<EP, a>::invoke(E, msg);
 }
 
+// run time error dispatcher.  Used when the error is only known at run
+// time - e.g. when it has been caught and is to be reported again.
+// Note that this instantiates all the actions of the policy so it
+// cannot be used with the trap_exception action.
+template<class EP>
+inline void
+runtime_dispatch(const safe_numerics_error & e, const char * msg){
+    switch(make_safe_numerics_action(e)){
+    case safe_numerics_actions::uninitialized_value:
+        EP::on_uninitialized_value(e, msg);
+        break;
+    case safe_numerics_actions::arithmetic_error:
+        EP::on_arithmetic_error(e, msg);
+        break;
+    case safe_numerics_actions::implementation_defined_behavior:
+        EP::on_implementation_defined_behavior(e, msg);
+        break;
+    case safe_numerics_actions::undefined_behavior:
+        EP::on_undefined_behavior(e, msg);
+        break;
+    default:
+        break;
+    }
+}
+
 template<class EP, class R>
 class dispatch_and_return {
 public:
@@ -224,6 +330,27 @@ using strict_trap_policy = exception_policy<
     trap_exception
 >;
 
+// runtime trap
+// as strict exception but terminate with a trap instruction rather than
+// throwing.  Suitable for hardened builds in which an overflow must stop
+// the program immediately and code size matters.
+using runtime_trap_policy = exception_policy<
+    runtime_trap_exception,
+    runtime_trap_exception,
+    runtime_trap_exception,
+    ignore_exception
+>;
+
+// sticky
+// record errors rather than throwing.  Check sticky_exception::error()
+// after a sequence of operations.
+using sticky_exception_policy = exception_policy<
+    sticky_exception,
+    sticky_exception,
+    sticky_exception,
+    ignore_exception
+>;
+
 // default policy
 // One would use this first. After experimentation, one might
 // replace some actions with ignore_exception
@@ -0,0 +1,109 @@
+#ifndef BOOST_NUMERIC_INSTANTIATIONS_HPP
+#define BOOST_NUMERIC_INSTANTIATIONS_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// explicit instantiations of the most common safe types and of their
+// arithmetic and comparison with operands of the same type.  They are
+// compiled once in the library boost_safe_numerics_instantiations.  A
+// program which links with that library defines
+// BOOST_SAFE_NUMERICS_EXTERN_INSTANTIATIONS.  safe_integer.hpp then
+// includes this header so that no other translation unit instantiates
+// them again.
+
+#include <cstdint>
+#include <limits>
+
+#include "safe_integer.hpp"
+#include "automatic.hpp"
+#include "exception_policies.hpp"
+
+// invoke X(T, P, E) for each instantiated safe type
+#define BOOST_SAFE_NUMERICS_FOR_EACH_POLICY(X, T)                    \
+    X(T, boost::safe_numerics::native,                                \
+        boost::safe_numerics::default_exception_policy)               \
+    X(T, boost::safe_numerics::native,                                \
+        boost::safe_numerics::loose_exception_policy)                 \
+    X(T, boost::safe_numerics::automatic,                             \
+        boost::safe_numerics::default_exception_policy)               \
+    X(T, boost::safe_numerics::automatic,                             \
+        boost::safe_numerics::loose_exception_policy)
+
+#define BOOST_SAFE_NUMERICS_FOR_EACH_INSTANTIATION(X)                 \
+    BOOST_SAFE_NUMERICS_FOR_EACH_POLICY(X, std::int8_t)               \
+    BOOST_SAFE_NUMERICS_FOR_EACH_POLICY(X, std::int16_t)              \
+    BOOST_SAFE_NUMERICS_FOR_EACH_POLICY(X, std::int32_t)              \
+    BOOST_SAFE_NUMERICS_FOR_EACH_POLICY(X, std::int64_t)              \
+    BOOST_SAFE_NUMERICS_FOR_EACH_POLICY(X, std::uint8_t)              \
+    BOOST_SAFE_NUMERICS_FOR_EACH_POLICY(X, std::uint16_t)             \
+    BOOST_SAFE_NUMERICS_FOR_EACH_POLICY(X, std::uint32_t)             \
+    BOOST_SAFE_NUMERICS_FOR_EACH_POLICY(X, std::uint64_t)
+
+// the instantiations of a binary operator of safe<T, P, E> and its result
+#define BOOST_SAFE_NUMERICS_INSTANTIATE_OPERATOR(EXTERN, T, P, E, R, OP) \
+    EXTERN template struct boost::safe_numerics::R<                   \
+        boost::safe_numerics::safe<T, P, E>,                          \
+        boost::safe_numerics::safe<T, P, E>                           \
+    >;                                                                \
+    EXTERN template typename boost::safe_numerics::R<                 \
+        boost::safe_numerics::safe<T, P, E>,                          \
+        boost::safe_numerics::safe<T, P, E>                           \
+    >::type                                                           \
+    boost::safe_numerics::operator OP(                                \
+        const boost::safe_numerics::safe<T, P, E> &,                  \
+        const boost::safe_numerics::safe<T, P, E> &                   \
+    );
+
+#define BOOST_SAFE_NUMERICS_INSTANTIATE_COMPARISON(EXTERN, T, P, E, R, OP) \
+    EXTERN template struct boost::safe_numerics::R<                   \
+        boost::safe_numerics::safe<T, P, E>,                          \
+        boost::safe_numerics::safe<T, P, E>                           \
+    >;                                                                \
+    EXTERN template bool                                              \
+    boost::safe_numerics::operator OP(                                \
+        const boost::safe_numerics::safe<T, P, E> &,                  \
+        const boost::safe_numerics::safe<T, P, E> &                   \
+    );
+
+// the instantiations of safe<T, P, E>.  The type is written in full as an
+// alias can't name the class of an explicit instantiation.
+#define BOOST_SAFE_NUMERICS_INSTANTIATE(EXTERN, T, P, E)              \
+    EXTERN template class boost::safe_numerics::safe_base<            \
+        T,                                                            \
+        std::numeric_limits<T>::min(),                                \
+        std::numeric_limits<T>::max(),                                \
+        P,                                                            \
+        E                                                             \
+    >;                                                                \
+    BOOST_SAFE_NUMERICS_INSTANTIATE_OPERATOR(                         \
+        EXTERN, T, P, E, addition_result, +)                          \
+    BOOST_SAFE_NUMERICS_INSTANTIATE_OPERATOR(                         \
+        EXTERN, T, P, E, subtraction_result, -)                       \
+    BOOST_SAFE_NUMERICS_INSTANTIATE_OPERATOR(                         \
+        EXTERN, T, P, E, multiplication_result, *)                    \
+    BOOST_SAFE_NUMERICS_INSTANTIATE_OPERATOR(                         \
+        EXTERN, T, P, E, division_result, /)                          \
+    BOOST_SAFE_NUMERICS_INSTANTIATE_OPERATOR(                         \
+        EXTERN, T, P, E, modulus_result, %)                           \
+    BOOST_SAFE_NUMERICS_INSTANTIATE_COMPARISON(                       \
+        EXTERN, T, P, E, less_than_result, <)                         \
+    BOOST_SAFE_NUMERICS_INSTANTIATE_COMPARISON(                       \
+        EXTERN, T, P, E, equal_result, ==)
+
+#define BOOST_SAFE_NUMERICS_EXTERN_INSTANTIATION(T, P, E)             \
+    BOOST_SAFE_NUMERICS_INSTANTIATE(extern, T, P, E)
+
+// the library itself defines the instantiations instead.  g++ won't emit
+// a constexpr member function which was declared extern and evaluated at
+// compile time before the definition of its instantiation.
+#if ! defined(BOOST_SAFE_NUMERICS_SOURCE)
+BOOST_SAFE_NUMERICS_FOR_EACH_INSTANTIATION(
+    BOOST_SAFE_NUMERICS_EXTERN_INSTANTIATION
+)
+#endif
+
+#endif // BOOST_NUMERIC_INSTANTIATIONS_HPP
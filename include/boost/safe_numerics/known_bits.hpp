@@ -0,0 +1,95 @@
+#ifndef BOOST_SAFE_NUMERICS_KNOWN_BITS_HPP
+#define BOOST_SAFE_NUMERICS_KNOWN_BITS_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// the bits of an unsigned value which are known to be zero or one.  An
+// interval is a poor description of the result of a bitwise operation.
+// For example, with x in [0, 255]
+//
+//     (x & 0xf0) | 3
+//
+// the interval of x & 0xf0 is [0, 240].  Every value of the result has
+// its two low bits set and its high bits clear so its interval is
+// [3, 255].  Here the interval of each argument is converted to the bits
+// which all its values have in common, the bitwise operation is applied
+// to these and the result is converted back to an interval.  The low bits
+// of [0, 240] aren't known, so the result can't be narrowed to [3, 243]
+// unless they are tracked as by safe_congruent.
+
+#include <limits>
+#include <type_traits>
+
+#include "interval.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+template<typename R>
+struct known_bits {
+    static_assert(
+        std::is_unsigned<R>::value,
+        "known bits are defined for unsigned types"
+    );
+    const R zeros; // mask of bits known to be zero
+    const R ones;  // mask of bits known to be one
+
+    constexpr known_bits(const R & z, const R & o) :
+        zeros(z),
+        ones(o)
+    {}
+
+    // the bits common to every value in [l, u] - that is those above the
+    // highest bit in which l and u differ.
+    constexpr explicit known_bits(const interval<R> & r) :
+        zeros(static_cast<R>(~r.l & high_mask(r.l ^ r.u))),
+        ones(static_cast<R>(r.l & high_mask(r.l ^ r.u)))
+    {}
+
+    // the smallest interval which holds every value with these bits
+    constexpr interval<R> to_interval() const {
+        return interval<R>(ones, static_cast<R>(~zeros));
+    }
+
+private:
+    // the mask of the bits above the highest bit set in d
+    constexpr static R high_mask(R d){
+        R m = static_cast<R>(~R(0));
+        for(; d != 0; d >>= 1)
+            m = static_cast<R>(m << 1);
+        return m;
+    }
+};
+
+template<typename R>
+constexpr known_bits<R> operator&(const known_bits<R> & t, const known_bits<R> & u){
+    return known_bits<R>(
+        static_cast<R>(t.zeros | u.zeros),
+        static_cast<R>(t.ones & u.ones)
+    );
+}
+
+template<typename R>
+constexpr known_bits<R> operator|(const known_bits<R> & t, const known_bits<R> & u){
+    return known_bits<R>(
+        static_cast<R>(t.zeros & u.zeros),
+        static_cast<R>(t.ones | u.ones)
+    );
+}
+
+template<typename R>
+constexpr known_bits<R> operator^(const known_bits<R> & t, const known_bits<R> & u){
+    return known_bits<R>(
+        static_cast<R>((t.zeros & u.zeros) | (t.ones & u.ones)),
+        static_cast<R>((t.zeros & u.ones) | (t.ones & u.zeros))
+    );
+}
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_SAFE_NUMERICS_KNOWN_BITS_HPP
@@ -0,0 +1,117 @@
+#ifndef BOOST_NUMERIC_PARALLEL_HPP
+#define BOOST_NUMERIC_PARALLEL_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// minimal support for the parallel variants of the algorithms in this
+// library.  Work is divided into contiguous chunks, each of which is
+// processed by its own std::thread.  The calling thread processes the
+// first chunk.  Programs which use these must link with the threads
+// library.
+
+#include <cstddef>   // size_t
+#include <exception> // exception_ptr
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace boost {
+namespace safe_numerics {
+
+struct parallel_policy {
+    // maximum number of threads to use.  0 means use the number of
+    // hardware threads.
+    unsigned int m_threads;
+    // minimum number of elements in a chunk.  Smaller jobs are not
+    // worth the cost of starting a thread.
+    std::size_t m_grain;
+
+    constexpr explicit parallel_policy(
+        unsigned int threads = 0,
+        std::size_t grain = 1u << 14
+    ) :
+        m_threads(threads),
+        m_grain(grain == 0 ? 1 : grain)
+    {}
+
+    unsigned int threads() const {
+        if(m_threads != 0)
+            return m_threads;
+        const unsigned int n = std::thread::hardware_concurrency();
+        return n == 0 ? 1 : n;
+    }
+
+    // the number of chunks into which n elements should be divided
+    std::size_t chunk_count(const std::size_t & n) const {
+        const std::size_t by_grain = n / m_grain + (n % m_grain != 0);
+        const std::size_t by_threads = threads();
+        const std::size_t c = by_grain < by_threads ? by_grain : by_threads;
+        return c == 0 ? 1 : c;
+    }
+};
+
+// the half open range of elements [first, last) of chunk i when n elements
+// are divided into c chunks of nearly equal size
+inline std::size_t chunk_begin(
+    const std::size_t & i,
+    const std::size_t & c,
+    const std::size_t & n
+){
+    return n / c * i + (i < n % c ? i : n % c);
+}
+
+// invoke f(i) for i in [0, c) each on its own thread and wait for all of
+// them to finish.  If any invocation throws, the exception from the lowest
+// numbered invocation is rethrown in the calling thread.
+template<class F>
+void parallel_invoke(const std::size_t & c, F f){
+    if(c <= 1){
+        f(std::size_t(0));
+        return;
+    }
+    std::vector<std::exception_ptr> errors(c);
+    auto run = [&](const std::size_t i){
+        try{
+            f(i);
+        }
+        catch(...){
+            errors[i] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(c - 1);
+    std::size_t started = 1;
+    try{
+        for(; started < c; ++started)
+            workers.emplace_back(run, started);
+    }
+    // if no more threads can be created, the calling thread
+    // processes the remaining invocations
+    catch(const std::system_error &){}
+    run(0);
+    for(std::size_t i = started; i < c; ++i)
+        run(i);
+    for(std::thread & t : workers)
+        t.join();
+    for(const std::exception_ptr & e : errors)
+        if(e)
+            std::rethrow_exception(e);
+}
+
+// invoke f(i, first, last) for each chunk i of [0, n) concurrently
+// and wait for all of them to finish.
+template<class F>
+void parallel_for_chunks(const std::size_t & c, const std::size_t & n, F f){
+    parallel_invoke(c, [&](const std::size_t i){
+        f(i, chunk_begin(i, c, n), chunk_begin(i + 1, c, n));
+    });
+}
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_PARALLEL_HPP
@@ -0,0 +1,63 @@
+#ifndef BOOST_NUMERIC_RANGE_KEY_HPP
+#define BOOST_NUMERIC_RANGE_KEY_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Containers and algorithms which use the value of a safe integer as an
+// index need to map the values [Min, Max] of the type to the offsets
+// 0 ... Max - Min.  Since the type guarantees that the value is in range
+// no run time checking is required.
+
+#include <cstdint>   // uintmax_t
+#include <limits>
+#include <type_traits>
+
+#include "safe_common.hpp"
+#include "safe_base.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+template<class KeyT>
+struct range_key_traits {
+    static_assert(
+        is_safe<KeyT>::value,
+        "key must be a safe integer type"
+    );
+    using stored_type = typename base_type<KeyT>::type;
+    static_assert(
+        std::is_integral<stored_type>::value,
+        "key must be a safe integer type"
+    );
+
+    constexpr static const stored_type min =
+        base_value(std::numeric_limits<KeyT>::min());
+    constexpr static const stored_type max =
+        base_value(std::numeric_limits<KeyT>::max());
+
+    // note the differences are calculated with modular arithmetic so
+    // these are correct even when min is negative
+    constexpr static const std::uintmax_t span =
+        static_cast<std::uintmax_t>(max) - static_cast<std::uintmax_t>(min);
+
+    constexpr static std::uintmax_t offset(const KeyT & k){
+        return static_cast<std::uintmax_t>(base_value(k))
+            - static_cast<std::uintmax_t>(min);
+    }
+    // the value of the key which corresponds to offset i
+    constexpr static KeyT key(const std::uintmax_t & i){
+        return KeyT(
+            static_cast<stored_type>(static_cast<std::uintmax_t>(min) + i),
+            typename KeyT::skip_validation()
+        );
+    }
+};
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_RANGE_KEY_HPP
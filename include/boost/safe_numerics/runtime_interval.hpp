@@ -0,0 +1,349 @@
+#ifndef BOOST_NUMERIC_RUNTIME_INTERVAL_HPP
+#define BOOST_NUMERIC_RUNTIME_INTERVAL_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// interval arithmetic for use at run time such as propagating bounds
+// through a large expression graph.  The operators in interval.hpp are
+// designed for compile time evaluation.  They find the extremes of an
+// initializer list and don't detect overflow unless they are used with
+// checked_result.  The functions here
+// a) calculate the corners with the compiler's overflow checking
+// builtins where available.
+// b) select the extremes with conditional moves rather than branches.
+// c) take a slow path only when a corner overflows.
+//
+//     runtime_interval::multiply(t, u)
+//
+// returns an interval<checked_result<T>> whose bounds are either values
+// or positive_overflow_error / negative_overflow_error in the same way
+// as the operators of interval.hpp applied to interval<checked_result<T>>.
+//
+// The batch variants process arrays of intervals whose lower and upper
+// bounds are held in separate arrays. A bound which overflows is replaced
+// by the most negative or most positive value of T and the number of
+// results with such bounds is returned.
+
+#include <cstddef>   // size_t
+#include <limits>
+#include <type_traits>
+
+#include "checked_result.hpp"
+#include "checked_default.hpp"
+#include "checked_integer.hpp"
+#include "interval.hpp"
+
+namespace boost {
+namespace safe_numerics {
+namespace runtime_interval {
+
+namespace detail {
+
+template<class T>
+constexpr typename std::enable_if<std::is_signed<T>::value, bool>::type
+is_negative(const T & t){
+    return t < 0;
+}
+template<class T>
+constexpr typename std::enable_if<! std::is_signed<T>::value, bool>::type
+is_negative(const T &){
+    return false;
+}
+
+// each operation sets r to the result and returns true if it overflowed.
+// negative returns true if an overflow would be negative.
+struct add {
+    template<class T>
+    static bool apply(const T & t, const T & u, T & r){
+        #if defined(__GNUC__) // gcc and clang
+        return __builtin_add_overflow(t, u, & r);
+        #else
+        const checked_result<T> c = checked::add<T>(t, u);
+        if(c.exception())
+            return true;
+        r = c;
+        return false;
+        #endif
+    }
+    template<class T>
+    static bool negative(const T & t, const T &){
+        return is_negative(t);
+    }
+};
+
+struct subtract {
+    template<class T>
+    static bool apply(const T & t, const T & u, T & r){
+        #if defined(__GNUC__)
+        return __builtin_sub_overflow(t, u, & r);
+        #else
+        const checked_result<T> c = checked::subtract<T>(t, u);
+        if(c.exception())
+            return true;
+        r = c;
+        return false;
+        #endif
+    }
+    template<class T>
+    static bool negative(const T & t, const T &){
+        // unsigned results can only overflow below zero
+        return std::is_signed<T>::value ? is_negative(t) : true;
+    }
+};
+
+struct multiply {
+    template<class T>
+    static bool apply(const T & t, const T & u, T & r){
+        #if defined(__GNUC__)
+        return __builtin_mul_overflow(t, u, & r);
+        #else
+        const checked_result<T> c = checked::multiply<T>(t, u);
+        if(c.exception())
+            return true;
+        r = c;
+        return false;
+        #endif
+    }
+    template<class T>
+    static bool negative(const T & t, const T & u){
+        return is_negative(t) != is_negative(u);
+    }
+};
+
+// the divisor is never zero here.  The only overflow is min / -1
+struct divide {
+    template<class T>
+    static bool apply(const T & t, const T & u, T & r){
+        const bool overflow =
+            std::is_signed<T>::value
+            && t == std::numeric_limits<T>::min()
+            && is_negative(u) && u == static_cast<T>(-1);
+        r = overflow ? t : static_cast<T>(t / u);
+        return overflow;
+    }
+    template<class T>
+    static bool negative(const T &, const T &){
+        return false;
+    }
+};
+
+// a corner of the result with overflows replaced by the limits of T
+template<class Op, class T>
+inline T corner(const T & t, const T & u, bool & neg, bool & pos){
+    T r;
+    const bool overflow = Op::apply(t, u, r);
+    const bool n = overflow && Op::negative(t, u);
+    neg |= n;
+    pos |= overflow && ! n;
+    // selected without branches
+    r = n ? std::numeric_limits<T>::min() : r;
+    r = (overflow && ! n) ? std::numeric_limits<T>::max() : r;
+    return r;
+}
+
+template<class T>
+constexpr T min2(const T & a, const T & b){
+    return b < a ? b : a;
+}
+template<class T>
+constexpr T max2(const T & a, const T & b){
+    return a < b ? b : a;
+}
+
+template<class T>
+inline checked_result<T> lower(const T & t, const bool & neg, const bool & pos, const bool & all_pos){
+    return neg
+        ? checked_result<T>(safe_numerics_error::negative_overflow_error, "interval underflow")
+        : (pos && all_pos)
+            ? checked_result<T>(safe_numerics_error::positive_overflow_error, "interval overflow")
+            : checked_result<T>(t);
+}
+template<class T>
+inline checked_result<T> upper(const T & t, const bool & neg, const bool & pos, const bool & all_neg){
+    return pos
+        ? checked_result<T>(safe_numerics_error::positive_overflow_error, "interval overflow")
+        : (neg && all_neg)
+            ? checked_result<T>(safe_numerics_error::negative_overflow_error, "interval underflow")
+            : checked_result<T>(t);
+}
+
+// result of an operation which is monotonic in each argument so the
+// bounds are given by the corners (t.l op u.a) and (t.u op u.b)
+template<class Op, class T>
+inline interval<checked_result<T>> monotonic(
+    const T & tl, const T & ua,
+    const T & tu, const T & ub
+){
+    bool nl = false, pl = false, nu = false, pu = false;
+    const T l = corner<Op>(tl, ua, nl, pl);
+    const T u = corner<Op>(tu, ub, nu, pu);
+    return interval<checked_result<T>>(
+        lower(l, nl, pl, pl),
+        upper(u, nu, pu, nu)
+    );
+}
+
+// result of an operation whose extremes are at some two of the four
+// corners
+template<class Op, class T>
+inline interval<checked_result<T>> four_corners(
+    const interval<T> & t,
+    const interval<T> & u
+){
+    bool n[4] = {false, false, false, false};
+    bool p[4] = {false, false, false, false};
+    const T c0 = corner<Op>(t.l, u.l, n[0], p[0]);
+    const T c1 = corner<Op>(t.l, u.u, n[1], p[1]);
+    const T c2 = corner<Op>(t.u, u.l, n[2], p[2]);
+    const T c3 = corner<Op>(t.u, u.u, n[3], p[3]);
+    const T l = min2(min2(c0, c1), min2(c2, c3));
+    const T h = max2(max2(c0, c1), max2(c2, c3));
+    const bool neg = n[0] | n[1] | n[2] | n[3];
+    const bool pos = p[0] | p[1] | p[2] | p[3];
+    return interval<checked_result<T>>(
+        lower(l, neg, pos, p[0] & p[1] & p[2] & p[3]),
+        upper(h, neg, pos, n[0] & n[1] & n[2] & n[3])
+    );
+}
+
+} // detail
+
+/////////////////////////////////////////////////////////////////
+// single intervals
+
+template<class T>
+inline interval<checked_result<T>> add(const interval<T> & t, const interval<T> & u){
+    return detail::monotonic<detail::add>(t.l, u.l, t.u, u.u);
+}
+
+template<class T>
+inline interval<checked_result<T>> subtract(const interval<T> & t, const interval<T> & u){
+    return detail::monotonic<detail::subtract>(t.l, u.u, t.u, u.l);
+}
+
+template<class T>
+inline interval<checked_result<T>> multiply(const interval<T> & t, const interval<T> & u){
+    return detail::four_corners<detail::multiply>(t, u);
+}
+
+// if the divisor includes zero, both bounds are domain errors
+template<class T>
+inline interval<checked_result<T>> divide(const interval<T> & t, const interval<T> & u){
+    if(! detail::is_negative(u.u) && ! (u.l > 0)) // u.l <= 0 <= u.u
+        return interval<checked_result<T>>(
+            checked_result<T>(safe_numerics_error::domain_error, "divisor includes zero"),
+            checked_result<T>(safe_numerics_error::domain_error, "divisor includes zero")
+        );
+    return detail::four_corners<detail::divide>(t, u);
+}
+
+/////////////////////////////////////////////////////////////////
+// arrays of intervals.  Interval i of t is [tl[i], tu[i]].  The result
+// for each is stored in [rl[i], ru[i]].  Each loop is branch free and
+// may be vectorized.
+
+namespace detail {
+
+template<class Op, class T>
+std::size_t monotonic(
+    const std::size_t & n,
+    const T * tl, const T * ua,
+    const T * tu, const T * ub,
+    T * rl, T * ru
+){
+    std::size_t overflows = 0;
+    for(std::size_t i = 0; i < n; ++i){
+        bool neg = false, pos = false;
+        rl[i] = corner<Op>(tl[i], ua[i], neg, pos);
+        ru[i] = corner<Op>(tu[i], ub[i], neg, pos);
+        overflows += (neg | pos);
+    }
+    return overflows;
+}
+
+template<class Op, class T>
+std::size_t four_corners(
+    const std::size_t & n,
+    const T * tl, const T * tu,
+    const T * ul, const T * uu,
+    T * rl, T * ru
+){
+    std::size_t overflows = 0;
+    for(std::size_t i = 0; i < n; ++i){
+        bool neg = false, pos = false;
+        const T c0 = corner<Op>(tl[i], ul[i], neg, pos);
+        const T c1 = corner<Op>(tl[i], uu[i], neg, pos);
+        const T c2 = corner<Op>(tu[i], ul[i], neg, pos);
+        const T c3 = corner<Op>(tu[i], uu[i], neg, pos);
+        rl[i] = min2(min2(c0, c1), min2(c2, c3));
+        ru[i] = max2(max2(c0, c1), max2(c2, c3));
+        overflows += (neg | pos);
+    }
+    return overflows;
+}
+
+} // detail
+
+template<class T>
+std::size_t add(
+    const std::size_t & n,
+    const T * tl, const T * tu,
+    const T * ul, const T * uu,
+    T * rl, T * ru
+){
+    return detail::monotonic<detail::add>(n, tl, ul, tu, uu, rl, ru);
+}
+
+template<class T>
+std::size_t subtract(
+    const std::size_t & n,
+    const T * tl, const T * tu,
+    const T * ul, const T * uu,
+    T * rl, T * ru
+){
+    return detail::monotonic<detail::subtract>(n, tl, uu, tu, ul, rl, ru);
+}
+
+template<class T>
+std::size_t multiply(
+    const std::size_t & n,
+    const T * tl, const T * tu,
+    const T * ul, const T * uu,
+    T * rl, T * ru
+){
+    return detail::four_corners<detail::multiply>(n, tl, tu, ul, uu, rl, ru);
+}
+
+// a result whose divisor includes zero is set to the whole range of T and
+// counted as an overflow
+template<class T>
+std::size_t divide(
+    const std::size_t & n,
+    const T * tl, const T * tu,
+    const T * ul, const T * uu,
+    T * rl, T * ru
+){
+    std::size_t overflows = 0;
+    for(std::size_t i = 0; i < n; ++i){
+        if(! detail::is_negative(uu[i]) && ! (ul[i] > 0)){
+            rl[i] = std::numeric_limits<T>::min();
+            ru[i] = std::numeric_limits<T>::max();
+            ++overflows;
+        }
+        else
+            overflows += detail::four_corners<detail::divide>(
+                1, tl + i, tu + i, ul + i, uu + i, rl + i, ru + i
+            );
+    }
+    return overflows;
+}
+
+} // runtime_interval
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_RUNTIME_INTERVAL_HPP
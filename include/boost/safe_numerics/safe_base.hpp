@@ -221,6 +221,13 @@ public:
     >
     constexpr /*explicit*/ operator R () const;
 
+    // convert to the stored type.  This can't fail.  The candidate
+    // functions for built-in operators such as array subscripting are
+    // only found through non-template conversions so without this a safe
+    // integer couldn't be used as an array index.  Released versions of
+    // the library have this conversion too.
+    constexpr /*explicit*/ operator Stored () const;
+
     /////////////////////////////////////////////////////////////////
     // modification binary operators
     template<class T>
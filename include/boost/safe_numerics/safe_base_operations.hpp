@@ -24,6 +24,7 @@
 #include "safe_base.hpp"
 
 #include "interval.hpp"
+#include "known_bits.hpp"
 #include "utility.hpp"
 
 namespace boost {
@@ -159,6 +160,13 @@ operator R () const {
     >::return_value(m_t);
 }
 
+// cast to the underlying type is always safe
+template< class Stored, Stored Min, Stored Max, class P, class E>
+constexpr inline safe_base<Stored, Min, Max, P, E>::
+operator Stored () const {
+    return m_t;
+}
+
 /////////////////////////////////////////////////////////////////
 // binary operators
 
@@ -246,31 +254,52 @@ struct common_promotion_policy {
 // helper - cast arguments to binary operators to a specified
 // result type
 
-template<class EP, class R, class T, class U>
-constexpr inline static std::pair<R, R> casting_helper(const T & t, const U & u){
-    using r_type = checked_result<R>;
-    const r_type tx = heterogeneous_checked_operation<
+// true if every value of T can be represented as an R
+template<class R, class T>
+constexpr bool cast_infallible(){
+    return
+        safe_compare::less_than_equal(
+            std::numeric_limits<R>::min(),
+            base_value(std::numeric_limits<T>::min())
+        )
+        && safe_compare::greater_than_equal(
+            std::numeric_limits<R>::max(),
+            base_value(std::numeric_limits<T>::max())
+        );
+}
+
+// the conversion of an argument which can't fail is a static_cast
+template<class EP, class R, class T>
+constexpr inline R cast_argument(const T & t, std::true_type){
+    return static_cast<R>(base_value(t));
+}
+
+template<class EP, class R, class T>
+constexpr inline R cast_argument(const T & t, std::false_type){
+    const checked_result<R> tx = heterogeneous_checked_operation<
         R,
         std::numeric_limits<R>::min(),
         std::numeric_limits<R>::max(),
         typename base_type<T>::type,
         dispatch_and_return<EP, R>
     >::cast(base_value(t));
-    const R tr = tx.exception()
+    return tx.exception()
         ? static_cast<R>(t)
         : tx.m_contents.m_r;
+}
 
-    const r_type ux = heterogeneous_checked_operation<
-        R,
-        std::numeric_limits<R>::min(),
-        std::numeric_limits<R>::max(),
-        typename base_type<U>::type,
-        dispatch_and_return<EP, R>
-    >::cast(base_value(u));
-    const R ur = ux.exception()
-        ? static_cast<R>(u)
-        : ux.m_contents.m_r;
-    return std::pair<R, R>(tr, ur);
+template<class EP, class R, class T, class U>
+constexpr inline static std::pair<R, R> casting_helper(const T & t, const U & u){
+    return std::pair<R, R>(
+        cast_argument<EP, R>(
+            t,
+            std::integral_constant<bool, cast_infallible<R, T>()>()
+        ),
+        cast_argument<EP, R>(
+            u,
+            std::integral_constant<bool, cast_infallible<R, U>()>()
+        )
+    );
 }
 
 // Note: the following global operators will be found via
@@ -746,7 +775,7 @@ private:
         constexpr const r_type_interval_t ri = get_r_type_interval();
         constexpr const r_type_interval_t ui = u_interval();
         return
-            static_cast<bool>(ui.includes(r_type(0)))
+            (static_cast<bool>(ui.includes(r_type(0))) && ! excludes_zero<U>::value)
             || ri.l.exception()
             || ri.u.exception();
     }
@@ -903,7 +932,7 @@ private:
         constexpr const r_type_interval_t ri = get_r_type_interval();
         constexpr const r_type_interval_t ui = u_interval();
         return
-            static_cast<bool>(ui.includes(r_type(0)))
+            (static_cast<bool>(ui.includes(r_type(0))) && ! excludes_zero<U>::value)
             || ri.l.exception()
             || ri.u.exception();
     }
@@ -956,70 +985,46 @@ constexpr inline operator%=(T & t, const U & u){
 /////////////////////////////////////////////////////////////////
 // comparison
 
+// Comparisons never convert their arguments.  safe_compare gives the
+// correct result for every pair of integers whatever their signedness so
+// there is nothing which could fail and no error to report.  When the
+// ranges of the arguments don't overlap the result is known at compile
+// time.  Otherwise the comparison is a single instruction unless one
+// argument is signed and the other unsigned.
+
 // less than
 
 template<class T, class U>
 struct less_than_result {
 private:
-    using promotion_policy = typename common_promotion_policy<T, U>::type;
-
-    using result_base_type =
-        typename promotion_policy::template comparison_result<T, U>::type;
-
-    // if exception not possible
-    constexpr static bool
-    return_value(const T & t, const U & u, std::false_type){
-        return
-            static_cast<result_base_type>(base_value(t))
-            < static_cast<result_base_type>(base_value(u));
-    }
-
-    using exception_policy = typename common_exception_policy<T, U>::type;
-
-    using r_type = checked_result<result_base_type>;
-
-    // if exception possible
-    constexpr static bool
-    return_value(const T & t, const U & u, std::true_type){
-        const std::pair<result_base_type, result_base_type> r = casting_helper<
-            exception_policy,
-            result_base_type
-        >(t, u);
-
-        return safe_compare::less_than(r.first, r.second);
+    using t_base_type = typename base_type<T>::type;
+    using u_base_type = typename base_type<U>::type;
+
+    // every value of T is less than every value of U
+    constexpr static bool always(){
+        return safe_compare::less_than(
+            base_value(std::numeric_limits<T>::max()),
+            base_value(std::numeric_limits<U>::min())
+        );
     }
-
-    using r_type_interval_t = interval<r_type>;
-
-    constexpr static bool interval_open(const r_type_interval_t & t){
-        return t.l.exception() || t.u.exception();
+    // no value of T is less than any value of U
+    constexpr static bool never(){
+        return safe_compare::greater_than_equal(
+            base_value(std::numeric_limits<T>::min()),
+            base_value(std::numeric_limits<U>::max())
+        );
     }
 
 public:
     constexpr static bool
     return_value(const T & t, const U & u){
-        constexpr const r_type_interval_t t_interval{
-            checked::cast<result_base_type>(base_value(std::numeric_limits<T>::min())),
-            checked::cast<result_base_type>(base_value(std::numeric_limits<T>::max()))
-        };
-        constexpr const r_type_interval_t u_interval{
-            checked::cast<result_base_type>(base_value(std::numeric_limits<U>::min())),
-            checked::cast<result_base_type>(base_value(std::numeric_limits<U>::max()))
-        };
-
-        if(t_interval < u_interval)
-            return true;
-        if(t_interval > u_interval)
-            return false;
-
-        constexpr bool exception_possible
-            = interval_open(t_interval) || interval_open(u_interval);
-
-        return return_value(
-            t,
-            u,
-            std::integral_constant<bool, exception_possible>()
-        );
+        return
+            always() ? true :
+            never() ? false :
+            safe_compare::less_than(
+                static_cast<t_base_type>(base_value(t)),
+                static_cast<u_base_type>(base_value(u))
+            );
     }
 };
 
@@ -1064,64 +1069,31 @@ constexpr inline operator<=(const T & lhs, const U & rhs) {
 template<class T, class U>
 struct equal_result {
 private:
-    using promotion_policy = typename common_promotion_policy<T, U>::type;
+    using t_base_type = typename base_type<T>::type;
+    using u_base_type = typename base_type<U>::type;
 
-    using result_base_type =
-        typename promotion_policy::template comparison_result<T, U>::type;
-
-    // if exception not possible
-    constexpr static bool
-    return_value(const T & t, const U & u, std::false_type){
+    // the ranges of T and U have no value in common
+    constexpr static bool never(){
         return
-            static_cast<result_base_type>(base_value(t))
-            == static_cast<result_base_type>(base_value(u));
-    }
-
-    using exception_policy = typename common_exception_policy<T, U>::type;
-
-    using r_type = checked_result<result_base_type>;
-
-    // exception possible
-    constexpr static bool
-    return_value(const T & t, const U & u, std::true_type){
-        const std::pair<result_base_type, result_base_type> r = casting_helper<
-            exception_policy,
-            result_base_type
-        >(t, u);
-
-        return safe_compare::equal(r.first, r.second);
-    }
-
-    using r_type_interval = interval<r_type>;
-
-    constexpr static bool interval_open(const r_type_interval & t){
-        return t.l.exception() || t.u.exception();
+            safe_compare::less_than(
+                base_value(std::numeric_limits<T>::max()),
+                base_value(std::numeric_limits<U>::min())
+            )
+            || safe_compare::greater_than(
+                base_value(std::numeric_limits<T>::min()),
+                base_value(std::numeric_limits<U>::max())
+            );
     }
 
 public:
     constexpr static bool
     return_value(const T & t, const U & u){
-        constexpr const r_type_interval t_interval{
-            checked::cast<result_base_type>(base_value(std::numeric_limits<T>::min())),
-            checked::cast<result_base_type>(base_value(std::numeric_limits<T>::max()))
-        };
-
-        constexpr const r_type_interval u_interval{
-            checked::cast<result_base_type>(base_value(std::numeric_limits<U>::min())),
-            checked::cast<result_base_type>(base_value(std::numeric_limits<U>::max()))
-        };
-
-        if(! intersect(t_interval, u_interval))
-            return false;
-
-        constexpr bool exception_possible
-            = interval_open(t_interval) || interval_open(u_interval);
-
-        return return_value(
-            t,
-            u,
-            std::integral_constant<bool, exception_possible>()
-        );
+        return
+            never() ? false :
+            safe_compare::equal(
+                static_cast<t_base_type>(base_value(t)),
+                static_cast<u_base_type>(base_value(u))
+            );
     }
 };
 
@@ -1423,6 +1395,22 @@ constexpr inline operator>>=(T & t, const U & u){
 /////////////////////////////////////////////////////////////////
 // bitwise operators
 
+// the bits of the values of an argument of a bitwise operation which are
+// known from its range.  Nothing is known about an argument which might
+// be negative.
+template<class R, class T>
+constexpr known_bits<R> argument_bits(){
+    return
+        base_value(std::numeric_limits<T>::min()) >= 0
+        && static_cast<std::uintmax_t>(base_value(std::numeric_limits<T>::max()))
+            <= std::numeric_limits<R>::max()
+        ? known_bits<R>(interval<R>(
+            static_cast<R>(base_value(std::numeric_limits<T>::min())),
+            static_cast<R>(base_value(std::numeric_limits<T>::max()))
+        ))
+        : known_bits<R>(0, 0);
+}
+
 // operator |
 template<class T, class U>
 struct bitwise_or_result {
@@ -1441,15 +1429,19 @@ private:
 
 public:
     // lazy_enable_if_c depends on this
+    // the range is narrowed by the bits known from the arguments
     using type = safe_base<
         result_base_type,
-        //r_interval.l,
-        r_type(0),
-        //r_interval.u,
-        utility::round_out(
-            std::max(
-                static_cast<r_type>(base_value(std::numeric_limits<T>::max())),
-                static_cast<r_type>(base_value(std::numeric_limits<U>::max()))
+        (argument_bits<r_type, T>() | argument_bits<r_type, U>()).ones,
+        std::min(
+            utility::round_out(
+                std::max(
+                    static_cast<r_type>(base_value(std::numeric_limits<T>::max())),
+                    static_cast<r_type>(base_value(std::numeric_limits<U>::max()))
+                )
+            ),
+            static_cast<r_type>(
+                ~(argument_bits<r_type, T>() | argument_bits<r_type, U>()).zeros
             )
         ),
         promotion_policy,
@@ -1510,15 +1502,19 @@ private:
 
 public:
     // lazy_enable_if_c depends on this
+    // the range is narrowed by the bits known from the arguments
     using type = safe_base<
         result_base_type,
-        //r_interval.l,
-        r_type(0),
-        //r_interval.u,
-        utility::round_out(
-            std::min(
-                static_cast<r_type>(base_value(std::numeric_limits<T>::max())),
-                static_cast<r_type>(base_value(std::numeric_limits<U>::max()))
+        (argument_bits<r_type, T>() & argument_bits<r_type, U>()).ones,
+        std::min(
+            utility::round_out(
+                std::min(
+                    static_cast<r_type>(base_value(std::numeric_limits<T>::max())),
+                    static_cast<r_type>(base_value(std::numeric_limits<U>::max()))
+                )
+            ),
+            static_cast<r_type>(
+                ~(argument_bits<r_type, T>() & argument_bits<r_type, U>()).zeros
             )
         ),
         promotion_policy,
@@ -1578,15 +1574,19 @@ struct bitwise_xor_result {
 
 public:
     // lazy_enable_if_c depends on this
+    // the range is narrowed by the bits known from the arguments
     using type = safe_base<
         result_base_type,
-        //r_interval.l,
-        r_type(0),
-        //r_interval.u,
-        utility::round_out(
-            std::max(
-                static_cast<r_type>(base_value(std::numeric_limits<T>::max())),
-                static_cast<r_type>(base_value(std::numeric_limits<U>::max()))
+        (argument_bits<r_type, T>() ^ argument_bits<r_type, U>()).ones,
+        std::min(
+            utility::round_out(
+                std::max(
+                    static_cast<r_type>(base_value(std::numeric_limits<T>::max())),
+                    static_cast<r_type>(base_value(std::numeric_limits<U>::max()))
+                )
+            ),
+            static_cast<r_type>(
+                ~(argument_bits<r_type, T>() ^ argument_bits<r_type, U>()).zeros
             )
         ),
         promotion_policy,
@@ -37,6 +37,13 @@ struct get_exception_policy {
     using type = void;
 };
 
+// true if the set of values of a type excludes zero even though its
+// range [Min, Max] includes it.  Division by such a type can't fail for
+// lack of a divisor.
+template<typename T>
+struct excludes_zero : public std::false_type
+{};
+
 
 } // safe_numerics
 } // boost
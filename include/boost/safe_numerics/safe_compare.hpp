@@ -7,6 +7,7 @@
 // accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <cstdint> // intmax_t, uintmax_t
 #include <type_traits>
 #include <limits>
 
@@ -173,6 +174,45 @@ constexpr inline bool not_equal(const T & lhs, const U & rhs) {
     return ! equal(lhs, rhs);
 }
 
+// true if min <= t <= max.  The offset t - min is compared with the span
+// max - min using unsigned arithmetic so that a value below min wraps
+// around to a large offset.  This is a single comparison rather than two.
+// It is exact as long as the distance between any value of T and either
+// bound is less than 2^N where N is the number of bits in uintmax_t.  This
+// holds unless one of them is negative and the other exceeds the largest
+// intmax_t in which case the two sided test is used.
+namespace safe_compare_detail {
+    template<class T, class R>
+    constexpr bool offset_exact(const R & min, const R & max){
+        return
+            (
+                greater_than_equal(std::numeric_limits<T>::min(), 0)
+                && greater_than_equal(min, 0)
+            ) || (
+                less_than_equal(
+                    std::numeric_limits<T>::max(),
+                    std::numeric_limits<std::intmax_t>::max()
+                )
+                && less_than_equal(
+                    max,
+                    std::numeric_limits<std::intmax_t>::max()
+                )
+            );
+    }
+} // safe_compare_detail
+
+template<class T, class R>
+typename std::enable_if<
+    std::is_integral<T>::value && std::is_integral<R>::value,
+    bool
+>::type
+constexpr inline in_range(const T & t, const R & min, const R & max) {
+    return safe_compare_detail::offset_exact<T>(min, max)
+        ? static_cast<std::uintmax_t>(t) - static_cast<std::uintmax_t>(min)
+            <= static_cast<std::uintmax_t>(max) - static_cast<std::uintmax_t>(min)
+        : greater_than_equal(t, min) && less_than_equal(t, max);
+}
+
 } // safe_compare
 } // safe_numerics
 } // boost
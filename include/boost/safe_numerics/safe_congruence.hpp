@@ -0,0 +1,1324 @@
+#ifndef BOOST_NUMERIC_SAFE_CONGRUENCE_HPP
+#define BOOST_NUMERIC_SAFE_CONGRUENCE_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// safe integers whose values are known to be congruent to R modulo M
+// in addition to lying in [Min, Max].  Byte offsets, for example, are
+// multiples of 4 or 8 but the interval [Min, Max] can't express this so
+// alignment checks and masks remain at run time.  Here
+//
+//     safe_aligned<std::uint32_t, 8> offset = ...;   // checked once
+//     safe_aligned<std::uint32_t, 8> stride = ...;
+//     auto next = offset + stride * n;
+//
+// next is known to be a multiple of 8 so is_aligned<8>(next) is true at
+// compile time.
+//
+// The congruence is propagated through +, -, *, <<, >>, &, | and ^ in
+// the same way as the interval is and the range of the result is
+// narrowed to the values which satisfy it.  The result of an operation with a
+// congruent argument is a congruent type - perhaps with modulus 1 if
+// nothing is known.  So an ordinary value can be tracked by converting it
+// to safe_congruent<T, 1> after which (x >> 2) << 2 and x & -4 are known
+// to be multiples of 4.  Safe values whose range holds a single value
+// such as safe literals are treated as known constants.
+
+#include <cstdint>   // intmax_t, uintmax_t
+#include <limits>
+#include <type_traits>
+#include <utility>   // declval
+#include <algorithm> // min, max
+
+#include <boost/config.hpp> // BOOST_UNLIKELY
+#include <boost/core/enable_if.hpp> // lazy_enable_if
+
+#include "safe_common.hpp"
+#include "safe_base.hpp"
+#include "safe_base_operations.hpp"
+#include "safe_compare.hpp"
+#include "native.hpp"
+#include "exception.hpp"
+#include "exception_policies.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M, // modulus
+    std::uintmax_t R, // residue
+    class P, // promotion policy
+    class E  // exception policy
+>
+class safe_congruent_base;
+
+namespace congruence_detail {
+
+// x == r (mod m).  A modulus of 0 means that the value is known to be
+// exactly r (or -r if negative).  Otherwise 0 <= r < m.
+struct congruence_t {
+    std::uintmax_t m;
+    std::uintmax_t r;
+    bool negative;
+};
+
+constexpr const unsigned digits = std::numeric_limits<std::uintmax_t>::digits;
+
+constexpr congruence_t unknown(){
+    return congruence_t{1, 0, false};
+}
+
+template<class T>
+constexpr congruence_t exact(const T & t){
+    return t < 0
+        ? congruence_t{0, 0u - static_cast<std::uintmax_t>(t), true}
+        : congruence_t{0, static_cast<std::uintmax_t>(t), false};
+}
+
+// the two's complement bits of the value of an exact congruence
+constexpr std::uintmax_t bits(const congruence_t & c){
+    return c.negative ? 0u - c.r : c.r;
+}
+
+constexpr std::uintmax_t gcd(std::uintmax_t a, std::uintmax_t b){
+    while(b != 0){
+        const std::uintmax_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+constexpr unsigned trailing_zeros(std::uintmax_t x){
+    if(x == 0)
+        return digits;
+    unsigned n = 0;
+    for(; (x & 1u) == 0; x >>= 1)
+        ++n;
+    return n;
+}
+
+constexpr std::uintmax_t low_mask(const unsigned & n){
+    return n >= digits ? ~std::uintmax_t(0) : (std::uintmax_t(1) << n) - 1;
+}
+
+// the residue of c modulo m > 0
+constexpr std::uintmax_t residue(const congruence_t & c, const std::uintmax_t & m){
+    return c.m != 0
+        ? c.r % m
+        : c.negative
+            ? (m - c.r % m) % m
+            : c.r % m;
+}
+
+// (a + b) mod m for a, b < m without overflow
+constexpr std::uintmax_t add_mod(
+    const std::uintmax_t & a,
+    const std::uintmax_t & b,
+    const std::uintmax_t & m
+){
+    return a >= m - b ? a - (m - b) : a + b;
+}
+
+// (a * b) mod m for a, b < m without overflow
+constexpr std::uintmax_t multiply_mod(
+    std::uintmax_t a,
+    std::uintmax_t b,
+    const std::uintmax_t & m
+){
+    std::uintmax_t r = 0;
+    for(; b != 0; b >>= 1){
+        if(b & 1u)
+            r = add_mod(r, a, m);
+        a = add_mod(a, a, m);
+    }
+    return r;
+}
+
+// the congruence of a value of type T.  The values of a type whose
+// range is a single value are known exactly.
+template<class T>
+struct congruence {
+    constexpr static congruence_t get(){
+        return
+            is_safe<T>::value
+            && base_value(std::numeric_limits<T>::min())
+                == base_value(std::numeric_limits<T>::max())
+            ? exact(base_value(std::numeric_limits<T>::min()))
+            : unknown();
+    }
+};
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E
+>
+struct congruence<safe_congruent_base<Stored, Min, Max, M, R, P, E> > {
+    constexpr static congruence_t get(){
+        return congruence_t{M, R, false};
+    }
+};
+
+// the least value of a shift count
+template<class U>
+constexpr unsigned least_shift(){
+    return
+        safe_compare::less_than(base_value(std::numeric_limits<U>::min()), 0)
+        ? 0
+        : safe_compare::greater_than(
+            base_value(std::numeric_limits<U>::min()),
+            digits
+        )
+            ? digits
+            : static_cast<unsigned>(base_value(std::numeric_limits<U>::min()));
+}
+
+/////////////////////////////////////////////////////////////////
+// transfer functions.  At least one of the arguments has a modulus
+// greater than one.
+
+struct plus {
+    template<class T, class U>
+    constexpr static auto apply(const T & t, const U & u){
+        return t + u;
+    }
+    constexpr static congruence_t get(
+        const congruence_t & t,
+        const congruence_t & u,
+        const unsigned &
+    ){
+        const std::uintmax_t m = gcd(t.m, u.m);
+        return congruence_t{m, add_mod(residue(t, m), residue(u, m), m), false};
+    }
+};
+
+struct minus {
+    template<class T, class U>
+    constexpr static auto apply(const T & t, const U & u){
+        return t - u;
+    }
+    constexpr static congruence_t get(
+        const congruence_t & t,
+        const congruence_t & u,
+        const unsigned &
+    ){
+        const std::uintmax_t m = gcd(t.m, u.m);
+        return congruence_t{
+            m,
+            add_mod(residue(t, m), (m - residue(u, m)) % m, m),
+            false
+        };
+    }
+};
+
+struct multiplies {
+    template<class T, class U>
+    constexpr static auto apply(const T & t, const U & u){
+        return t * u;
+    }
+    constexpr static bool overflows(const std::uintmax_t & a, const std::uintmax_t & b){
+        return a != 0 && b > std::numeric_limits<std::uintmax_t>::max() / a;
+    }
+    // (q t.m + t.r) k = q (t.m k) + t.r k
+    constexpr static congruence_t by_constant(
+        const congruence_t & t,
+        const congruence_t & k
+    ){
+        if(k.r == 0)
+            return k;
+        if(overflows(t.m, k.r))
+            return unknown();
+        const std::uintmax_t m = t.m * k.r;
+        const std::uintmax_t r = t.r * k.r; // < m
+        return congruence_t{m, k.negative ? (m - r) % m : r, false};
+    }
+    // (q t.m + t.r)(p u.m + u.r) =
+    //     q p t.m u.m + q t.m u.r + p u.m t.r + t.r u.r
+    constexpr static congruence_t get(
+        const congruence_t & t,
+        const congruence_t & u,
+        const unsigned &
+    ){
+        if(u.m == 0)
+            return by_constant(t, u);
+        if(t.m == 0)
+            return by_constant(u, t);
+        if(overflows(t.m, u.m) || overflows(t.m, u.r) || overflows(u.m, t.r))
+            return unknown();
+        const std::uintmax_t m = gcd(t.m * u.m, gcd(t.m * u.r, u.m * t.r));
+        return congruence_t{m, multiply_mod(t.r % m, u.r % m, m), false};
+    }
+};
+
+struct left_shift {
+    template<class T, class U>
+    constexpr static auto apply(const T & t, const U & u){
+        return t << u;
+    }
+    constexpr static congruence_t get(
+        const congruence_t & t,
+        const congruence_t & u,
+        const unsigned & least_shift
+    ){
+        // a known shift scales the modulus and the residue
+        if(u.m == 0 && ! u.negative && t.m != 0){
+            if(u.r >= digits
+            || t.m > (std::numeric_limits<std::uintmax_t>::max() >> u.r))
+                return unknown();
+            return congruence_t{t.m << u.r, t.r << u.r, false};
+        }
+        // otherwise the result is a multiple of gcd(t.m, t.r) << least_shift
+        const std::uintmax_t g = t.m == 0 ? t.r : gcd(t.m, t.r);
+        if(g == 0 || least_shift >= digits
+        || g > (std::numeric_limits<std::uintmax_t>::max() >> least_shift))
+            return unknown();
+        return congruence_t{g << least_shift, 0, false};
+    }
+};
+
+struct right_shift {
+    template<class T, class U>
+    constexpr static auto apply(const T & t, const U & u){
+        return t >> u;
+    }
+    // (q t.m + t.r) >> k = q (t.m >> k) + (t.r >> k) if 2^k divides t.m
+    constexpr static congruence_t get(
+        const congruence_t & t,
+        const congruence_t & u,
+        const unsigned &
+    ){
+        if(u.m == 0 && ! u.negative && u.r < digits && t.m != 0
+        && (t.m & low_mask(static_cast<unsigned>(u.r))) == 0)
+            return congruence_t{t.m >> u.r, t.r >> u.r, false};
+        return unknown();
+    }
+};
+
+// the number of low order bits whose values are known
+constexpr unsigned low_bits(const congruence_t & c){
+    return c.m == 0 ? digits : trailing_zeros(c.m);
+}
+constexpr std::uintmax_t low_value(const congruence_t & c){
+    return c.m == 0 ? bits(c) : c.r & low_mask(low_bits(c));
+}
+// the number of low order bits known to be zero
+constexpr unsigned low_zeros(const congruence_t & c){
+    return std::min(low_bits(c), trailing_zeros(low_value(c)));
+}
+// a congruence modulo 2^k
+constexpr congruence_t power_of_two(const unsigned & k, const std::uintmax_t & r){
+    return k >= digits
+        ? congruence_t{0, r, false}
+        : congruence_t{std::uintmax_t(1) << k, r & low_mask(k), false};
+}
+
+struct bitwise_and {
+    template<class T, class U>
+    constexpr static auto apply(const T & t, const U & u){
+        return t & u;
+    }
+    // the low bits of the result are known where they are known in
+    // both arguments or known to be zero in either one.
+    constexpr static congruence_t get(
+        const congruence_t & t,
+        const congruence_t & u,
+        const unsigned &
+    ){
+        const unsigned n = std::min(low_bits(t), low_bits(u));
+        return power_of_two(
+            std::max(n, std::max(low_zeros(t), low_zeros(u))),
+            low_value(t) & low_value(u) & low_mask(n)
+        );
+    }
+};
+
+struct bitwise_or {
+    template<class T, class U>
+    constexpr static auto apply(const T & t, const U & u){
+        return t | u;
+    }
+    constexpr static congruence_t get(
+        const congruence_t & t,
+        const congruence_t & u,
+        const unsigned &
+    ){
+        return power_of_two(
+            std::min(low_bits(t), low_bits(u)),
+            low_value(t) | low_value(u)
+        );
+    }
+};
+
+struct bitwise_xor {
+    template<class T, class U>
+    constexpr static auto apply(const T & t, const U & u){
+        return t ^ u;
+    }
+    constexpr static congruence_t get(
+        const congruence_t & t,
+        const congruence_t & u,
+        const unsigned &
+    ){
+        return power_of_two(
+            std::min(low_bits(t), low_bits(u)),
+            low_value(t) ^ low_value(u)
+        );
+    }
+};
+
+template<class T>
+struct base_of {
+    using type = T;
+};
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E
+>
+struct base_of<safe_congruent_base<Stored, Min, Max, M, R, P, E> > {
+    using type = safe_base<Stored, Min, Max, P, E>;
+};
+
+template<class T>
+constexpr const typename base_of<T>::type & as_base(const T & t){
+    return t;
+}
+
+// the congruence of the result of an operation on a congruent type.  A
+// result which is known exactly is given the modulus 1 since its range
+// holds the value.
+template<class Op, class T, class U>
+constexpr congruence_t result_congruence(){
+    return Op::get(
+        congruence<T>::get(),
+        congruence<U>::get(),
+        least_shift<U>()
+    ).m == 0
+        ? unknown()
+        : Op::get(
+            congruence<T>::get(),
+            congruence<U>::get(),
+            least_shift<U>()
+        );
+}
+
+// the least value >= t and the greatest value <= t congruent to c
+template<class T>
+constexpr T round_up(const T & t, const congruence_t & c){
+    return static_cast<T>(
+        static_cast<std::uintmax_t>(t)
+        + add_mod(c.r, (c.m - residue(exact(t), c.m)) % c.m, c.m)
+    );
+}
+template<class T>
+constexpr T round_down(const T & t, const congruence_t & c){
+    return static_cast<T>(
+        static_cast<std::uintmax_t>(t)
+        - add_mod(residue(exact(t), c.m), (c.m - c.r) % c.m, c.m)
+    );
+}
+
+// the range [l, u] of the result narrowed to the values congruent to c
+// if there are any
+template<class T>
+constexpr interval<T> narrow(const T & l, const T & u, const congruence_t & c){
+    return
+        l <= round_up(l, c) && round_up(l, c) <= round_down(u, c)
+        && round_down(u, c) <= u
+        ? interval<T>(round_up(l, c), round_down(u, c))
+        : interval<T>(l, u);
+}
+
+template<class Op, class T, class U>
+struct result {
+    using base_result = decltype(
+        Op::apply(
+            as_base(std::declval<const T &>()),
+            as_base(std::declval<const U &>())
+        )
+    );
+    using stored_type = typename base_type<base_result>::type;
+    using type = safe_congruent_base<
+        stored_type,
+        narrow(
+            base_value(std::numeric_limits<base_result>::min()),
+            base_value(std::numeric_limits<base_result>::max()),
+            result_congruence<Op, T, U>()
+        ).l,
+        narrow(
+            base_value(std::numeric_limits<base_result>::min()),
+            base_value(std::numeric_limits<base_result>::max()),
+            result_congruence<Op, T, U>()
+        ).u,
+        result_congruence<Op, T, U>().m,
+        result_congruence<Op, T, U>().r,
+        typename get_promotion_policy<base_result>::type,
+        typename get_exception_policy<base_result>::type
+    >;
+};
+
+template<class Op, class T, class U>
+constexpr typename result<Op, T, U>::type apply(const T & t, const U & u){
+    using type = typename result<Op, T, U>::type;
+    return type(
+        base_value(Op::apply(as_base(t), as_base(u))),
+        typename type::skip_validation()
+    );
+}
+
+// arguments which may be combined with a congruent type.  This excludes
+// streams from the shift operators.
+template<class T>
+using is_operand = std::integral_constant<
+    bool,
+    is_safe<T>::value || std::is_integral<T>::value
+>;
+
+} // congruence_detail
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E
+>
+class safe_congruent_base : public safe_base<Stored, Min, Max, P, E> {
+    static_assert(M > 0, "the modulus must be greater than zero");
+    static_assert(R < M, "the residue must be less than the modulus");
+    using base_t = safe_base<Stored, Min, Max, P, E>;
+
+    // the check is only required if the congruence of the source type
+    // doesn't imply that of this one
+    template<class T>
+    constexpr static bool check_required(){
+        return
+            congruence_detail::congruence<T>::get().m % M != 0
+            || congruence_detail::residue(
+                congruence_detail::congruence<T>::get(), M
+            ) != R;
+    }
+    constexpr static void check(const Stored &, std::false_type){}
+    constexpr static void check(const Stored & s, std::true_type){
+        if(BOOST_UNLIKELY(
+            congruence_detail::residue(congruence_detail::exact(s), M) != R
+        ))
+            dispatch<E, safe_numerics_error::range_error>(
+                "value is not congruent to the residue"
+            );
+    }
+    // the value of t validated first by the base type and then for its
+    // congruence.  Nothing is stored until both checks have passed.
+    template<class T>
+    constexpr static Stored validated(const T & t){
+        const Stored s = static_cast<Stored>(base_t(t));
+        check(s, std::integral_constant<bool, check_required<T>()>());
+        return s;
+    }
+
+public:
+    using skip_validation = typename base_t::skip_validation;
+
+    constexpr safe_congruent_base() = default;
+
+    constexpr explicit safe_congruent_base(const Stored & t, skip_validation) :
+        base_t(t, skip_validation())
+    {}
+
+    template<
+        class T,
+        typename std::enable_if<
+            std::is_convertible<T, Stored>::value,
+            bool
+        >::type = 0
+    >
+    constexpr /*explicit*/ safe_congruent_base(const T & t) :
+        base_t(validated(t), skip_validation())
+    {}
+
+    template<typename T, T N, class Px, class Ex>
+    constexpr /*explicit*/ safe_congruent_base(
+        const safe_literal_impl<T, N, Px, Ex> & t
+    ) :
+        base_t(validated(t), skip_validation())
+    {}
+
+    constexpr safe_congruent_base(const safe_congruent_base &) = default;
+    constexpr safe_congruent_base & operator=(const safe_congruent_base &) = default;
+    constexpr safe_congruent_base(safe_congruent_base &&) = default;
+    constexpr safe_congruent_base & operator=(safe_congruent_base &&) = default;
+
+    template<class T>
+    constexpr safe_congruent_base & operator=(const T & rhs){
+        const Stored s = validated(rhs);
+        base_t::operator=(base_t(s, skip_validation()));
+        return *this;
+    }
+
+    // the mutating operators of safe_base would bypass the check
+    safe_congruent_base & operator++(){
+        return *this = *this + 1;
+    }
+    safe_congruent_base & operator--(){
+        return *this = *this - 1;
+    }
+    safe_congruent_base operator++(int){
+        const safe_congruent_base old_t = *this;
+        ++(*this);
+        return old_t;
+    }
+    safe_congruent_base operator--(int){
+        const safe_congruent_base old_t = *this;
+        --(*this);
+        return old_t;
+    }
+};
+
+template<
+    class T,
+    T Min,
+    T Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E
+>
+struct is_safe<safe_congruent_base<T, Min, Max, M, R, P, E> > : public std::true_type
+{};
+
+template<
+    class T,
+    T Min,
+    T Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E
+>
+struct get_promotion_policy<safe_congruent_base<T, Min, Max, M, R, P, E> > {
+    using type = P;
+};
+
+template<
+    class T,
+    T Min,
+    T Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E
+>
+struct get_exception_policy<safe_congruent_base<T, Min, Max, M, R, P, E> > {
+    using type = E;
+};
+
+template<
+    class T,
+    T Min,
+    T Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E
+>
+struct base_type<safe_congruent_base<T, Min, Max, M, R, P, E> > {
+    using type = T;
+};
+
+template<
+    class T,
+    T Min,
+    T Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E
+>
+constexpr T base_value(
+    const safe_congruent_base<T, Min, Max, M, R, P, E>  & st
+) {
+    return static_cast<T>(st);
+}
+
+/////////////////////////////////////////////////////////////////
+// operators which propagate the congruence.  There are overloads for
+// a congruent type on either side and on both sides so that these are
+// more specialized than the operators of safe_base.  Note that the
+// result is evaluated lazily so that streams are not mistaken for
+// shifted values.
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E,
+    class U
+>
+constexpr inline typename boost::lazy_enable_if_c<
+    congruence_detail::is_operand<U>::value,
+    congruence_detail::result<
+        congruence_detail::plus,
+        safe_congruent_base<Stored, Min, Max, M, R, P, E>,
+        U
+    >
+>::type
+operator+(const safe_congruent_base<Stored, Min, Max, M, R, P, E> & t, const U & u){
+    return congruence_detail::apply<congruence_detail::plus>(t, u);
+}
+
+template<
+    class T,
+    class StoredU,
+    StoredU MinU,
+    StoredU MaxU,
+    std::uintmax_t MU,
+    std::uintmax_t RU,
+    class PU,
+    class EU
+>
+constexpr inline typename boost::lazy_enable_if_c<
+    congruence_detail::is_operand<T>::value,
+    congruence_detail::result<
+        congruence_detail::plus,
+        T,
+        safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU>
+    >
+>::type
+operator+(const T & t, const safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU> & u){
+    return congruence_detail::apply<congruence_detail::plus>(t, u);
+}
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E,
+    class StoredU,
+    StoredU MinU,
+    StoredU MaxU,
+    std::uintmax_t MU,
+    std::uintmax_t RU,
+    class PU,
+    class EU
+>
+constexpr inline typename congruence_detail::result<
+    congruence_detail::plus,
+    safe_congruent_base<Stored, Min, Max, M, R, P, E>,
+    safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU>
+>::type
+operator+(const safe_congruent_base<Stored, Min, Max, M, R, P, E> & t, const safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU> & u){
+    return congruence_detail::apply<congruence_detail::plus>(t, u);
+}
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E,
+    class U
+>
+constexpr inline typename boost::lazy_enable_if_c<
+    congruence_detail::is_operand<U>::value,
+    congruence_detail::result<
+        congruence_detail::minus,
+        safe_congruent_base<Stored, Min, Max, M, R, P, E>,
+        U
+    >
+>::type
+operator-(const safe_congruent_base<Stored, Min, Max, M, R, P, E> & t, const U & u){
+    return congruence_detail::apply<congruence_detail::minus>(t, u);
+}
+
+template<
+    class T,
+    class StoredU,
+    StoredU MinU,
+    StoredU MaxU,
+    std::uintmax_t MU,
+    std::uintmax_t RU,
+    class PU,
+    class EU
+>
+constexpr inline typename boost::lazy_enable_if_c<
+    congruence_detail::is_operand<T>::value,
+    congruence_detail::result<
+        congruence_detail::minus,
+        T,
+        safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU>
+    >
+>::type
+operator-(const T & t, const safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU> & u){
+    return congruence_detail::apply<congruence_detail::minus>(t, u);
+}
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E,
+    class StoredU,
+    StoredU MinU,
+    StoredU MaxU,
+    std::uintmax_t MU,
+    std::uintmax_t RU,
+    class PU,
+    class EU
+>
+constexpr inline typename congruence_detail::result<
+    congruence_detail::minus,
+    safe_congruent_base<Stored, Min, Max, M, R, P, E>,
+    safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU>
+>::type
+operator-(const safe_congruent_base<Stored, Min, Max, M, R, P, E> & t, const safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU> & u){
+    return congruence_detail::apply<congruence_detail::minus>(t, u);
+}
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E,
+    class U
+>
+constexpr inline typename boost::lazy_enable_if_c<
+    congruence_detail::is_operand<U>::value,
+    congruence_detail::result<
+        congruence_detail::multiplies,
+        safe_congruent_base<Stored, Min, Max, M, R, P, E>,
+        U
+    >
+>::type
+operator*(const safe_congruent_base<Stored, Min, Max, M, R, P, E> & t, const U & u){
+    return congruence_detail::apply<congruence_detail::multiplies>(t, u);
+}
+
+template<
+    class T,
+    class StoredU,
+    StoredU MinU,
+    StoredU MaxU,
+    std::uintmax_t MU,
+    std::uintmax_t RU,
+    class PU,
+    class EU
+>
+constexpr inline typename boost::lazy_enable_if_c<
+    congruence_detail::is_operand<T>::value,
+    congruence_detail::result<
+        congruence_detail::multiplies,
+        T,
+        safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU>
+    >
+>::type
+operator*(const T & t, const safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU> & u){
+    return congruence_detail::apply<congruence_detail::multiplies>(t, u);
+}
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E,
+    class StoredU,
+    StoredU MinU,
+    StoredU MaxU,
+    std::uintmax_t MU,
+    std::uintmax_t RU,
+    class PU,
+    class EU
+>
+constexpr inline typename congruence_detail::result<
+    congruence_detail::multiplies,
+    safe_congruent_base<Stored, Min, Max, M, R, P, E>,
+    safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU>
+>::type
+operator*(const safe_congruent_base<Stored, Min, Max, M, R, P, E> & t, const safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU> & u){
+    return congruence_detail::apply<congruence_detail::multiplies>(t, u);
+}
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E,
+    class U
+>
+constexpr inline typename boost::lazy_enable_if_c<
+    congruence_detail::is_operand<U>::value,
+    congruence_detail::result<
+        congruence_detail::left_shift,
+        safe_congruent_base<Stored, Min, Max, M, R, P, E>,
+        U
+    >
+>::type
+operator<<(const safe_congruent_base<Stored, Min, Max, M, R, P, E> & t, const U & u){
+    return congruence_detail::apply<congruence_detail::left_shift>(t, u);
+}
+
+template<
+    class T,
+    class StoredU,
+    StoredU MinU,
+    StoredU MaxU,
+    std::uintmax_t MU,
+    std::uintmax_t RU,
+    class PU,
+    class EU
+>
+constexpr inline typename boost::lazy_enable_if_c<
+    congruence_detail::is_operand<T>::value,
+    congruence_detail::result<
+        congruence_detail::left_shift,
+        T,
+        safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU>
+    >
+>::type
+operator<<(const T & t, const safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU> & u){
+    return congruence_detail::apply<congruence_detail::left_shift>(t, u);
+}
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E,
+    class StoredU,
+    StoredU MinU,
+    StoredU MaxU,
+    std::uintmax_t MU,
+    std::uintmax_t RU,
+    class PU,
+    class EU
+>
+constexpr inline typename congruence_detail::result<
+    congruence_detail::left_shift,
+    safe_congruent_base<Stored, Min, Max, M, R, P, E>,
+    safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU>
+>::type
+operator<<(const safe_congruent_base<Stored, Min, Max, M, R, P, E> & t, const safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU> & u){
+    return congruence_detail::apply<congruence_detail::left_shift>(t, u);
+}
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E,
+    class U
+>
+constexpr inline typename boost::lazy_enable_if_c<
+    congruence_detail::is_operand<U>::value,
+    congruence_detail::result<
+        congruence_detail::right_shift,
+        safe_congruent_base<Stored, Min, Max, M, R, P, E>,
+        U
+    >
+>::type
+operator>>(const safe_congruent_base<Stored, Min, Max, M, R, P, E> & t, const U & u){
+    return congruence_detail::apply<congruence_detail::right_shift>(t, u);
+}
+
+template<
+    class T,
+    class StoredU,
+    StoredU MinU,
+    StoredU MaxU,
+    std::uintmax_t MU,
+    std::uintmax_t RU,
+    class PU,
+    class EU
+>
+constexpr inline typename boost::lazy_enable_if_c<
+    congruence_detail::is_operand<T>::value,
+    congruence_detail::result<
+        congruence_detail::right_shift,
+        T,
+        safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU>
+    >
+>::type
+operator>>(const T & t, const safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU> & u){
+    return congruence_detail::apply<congruence_detail::right_shift>(t, u);
+}
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E,
+    class StoredU,
+    StoredU MinU,
+    StoredU MaxU,
+    std::uintmax_t MU,
+    std::uintmax_t RU,
+    class PU,
+    class EU
+>
+constexpr inline typename congruence_detail::result<
+    congruence_detail::right_shift,
+    safe_congruent_base<Stored, Min, Max, M, R, P, E>,
+    safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU>
+>::type
+operator>>(const safe_congruent_base<Stored, Min, Max, M, R, P, E> & t, const safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU> & u){
+    return congruence_detail::apply<congruence_detail::right_shift>(t, u);
+}
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E,
+    class U
+>
+constexpr inline typename boost::lazy_enable_if_c<
+    congruence_detail::is_operand<U>::value,
+    congruence_detail::result<
+        congruence_detail::bitwise_and,
+        safe_congruent_base<Stored, Min, Max, M, R, P, E>,
+        U
+    >
+>::type
+operator&(const safe_congruent_base<Stored, Min, Max, M, R, P, E> & t, const U & u){
+    return congruence_detail::apply<congruence_detail::bitwise_and>(t, u);
+}
+
+template<
+    class T,
+    class StoredU,
+    StoredU MinU,
+    StoredU MaxU,
+    std::uintmax_t MU,
+    std::uintmax_t RU,
+    class PU,
+    class EU
+>
+constexpr inline typename boost::lazy_enable_if_c<
+    congruence_detail::is_operand<T>::value,
+    congruence_detail::result<
+        congruence_detail::bitwise_and,
+        T,
+        safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU>
+    >
+>::type
+operator&(const T & t, const safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU> & u){
+    return congruence_detail::apply<congruence_detail::bitwise_and>(t, u);
+}
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E,
+    class StoredU,
+    StoredU MinU,
+    StoredU MaxU,
+    std::uintmax_t MU,
+    std::uintmax_t RU,
+    class PU,
+    class EU
+>
+constexpr inline typename congruence_detail::result<
+    congruence_detail::bitwise_and,
+    safe_congruent_base<Stored, Min, Max, M, R, P, E>,
+    safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU>
+>::type
+operator&(const safe_congruent_base<Stored, Min, Max, M, R, P, E> & t, const safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU> & u){
+    return congruence_detail::apply<congruence_detail::bitwise_and>(t, u);
+}
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E,
+    class U
+>
+constexpr inline typename boost::lazy_enable_if_c<
+    congruence_detail::is_operand<U>::value,
+    congruence_detail::result<
+        congruence_detail::bitwise_or,
+        safe_congruent_base<Stored, Min, Max, M, R, P, E>,
+        U
+    >
+>::type
+operator|(const safe_congruent_base<Stored, Min, Max, M, R, P, E> & t, const U & u){
+    return congruence_detail::apply<congruence_detail::bitwise_or>(t, u);
+}
+
+template<
+    class T,
+    class StoredU,
+    StoredU MinU,
+    StoredU MaxU,
+    std::uintmax_t MU,
+    std::uintmax_t RU,
+    class PU,
+    class EU
+>
+constexpr inline typename boost::lazy_enable_if_c<
+    congruence_detail::is_operand<T>::value,
+    congruence_detail::result<
+        congruence_detail::bitwise_or,
+        T,
+        safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU>
+    >
+>::type
+operator|(const T & t, const safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU> & u){
+    return congruence_detail::apply<congruence_detail::bitwise_or>(t, u);
+}
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E,
+    class StoredU,
+    StoredU MinU,
+    StoredU MaxU,
+    std::uintmax_t MU,
+    std::uintmax_t RU,
+    class PU,
+    class EU
+>
+constexpr inline typename congruence_detail::result<
+    congruence_detail::bitwise_or,
+    safe_congruent_base<Stored, Min, Max, M, R, P, E>,
+    safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU>
+>::type
+operator|(const safe_congruent_base<Stored, Min, Max, M, R, P, E> & t, const safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU> & u){
+    return congruence_detail::apply<congruence_detail::bitwise_or>(t, u);
+}
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E,
+    class U
+>
+constexpr inline typename boost::lazy_enable_if_c<
+    congruence_detail::is_operand<U>::value,
+    congruence_detail::result<
+        congruence_detail::bitwise_xor,
+        safe_congruent_base<Stored, Min, Max, M, R, P, E>,
+        U
+    >
+>::type
+operator^(const safe_congruent_base<Stored, Min, Max, M, R, P, E> & t, const U & u){
+    return congruence_detail::apply<congruence_detail::bitwise_xor>(t, u);
+}
+
+template<
+    class T,
+    class StoredU,
+    StoredU MinU,
+    StoredU MaxU,
+    std::uintmax_t MU,
+    std::uintmax_t RU,
+    class PU,
+    class EU
+>
+constexpr inline typename boost::lazy_enable_if_c<
+    congruence_detail::is_operand<T>::value,
+    congruence_detail::result<
+        congruence_detail::bitwise_xor,
+        T,
+        safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU>
+    >
+>::type
+operator^(const T & t, const safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU> & u){
+    return congruence_detail::apply<congruence_detail::bitwise_xor>(t, u);
+}
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E,
+    class StoredU,
+    StoredU MinU,
+    StoredU MaxU,
+    std::uintmax_t MU,
+    std::uintmax_t RU,
+    class PU,
+    class EU
+>
+constexpr inline typename congruence_detail::result<
+    congruence_detail::bitwise_xor,
+    safe_congruent_base<Stored, Min, Max, M, R, P, E>,
+    safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU>
+>::type
+operator^(const safe_congruent_base<Stored, Min, Max, M, R, P, E> & t, const safe_congruent_base<StoredU, MinU, MaxU, MU, RU, PU, EU> & u){
+    return congruence_detail::apply<congruence_detail::bitwise_xor>(t, u);
+}
+
+/////////////////////////////////////////////////////////////////
+// alignment tests.  The result is known at compile time if the
+// congruence of the type determines the residue modulo A.
+
+namespace congruence_detail {
+
+template<std::uintmax_t A, class T>
+struct aligned {
+    constexpr static bool test(const T &, std::true_type){
+        return residue(congruence<T>::get(), A) == 0;
+    }
+    constexpr static bool test(const T & t, std::false_type){
+        return residue(exact(base_value(t)), A) == 0;
+    }
+};
+
+} // congruence_detail
+
+template<std::uintmax_t A, class T>
+constexpr bool is_aligned(const T & t){
+    static_assert(A > 0, "alignment must be greater than zero");
+    return congruence_detail::aligned<A, T>::test(
+        t,
+        std::integral_constant<
+            bool,
+            congruence_detail::congruence<T>::get().m % A == 0
+        >()
+    );
+}
+
+/////////////////////////////////////////////////////////////////
+// all the values of T congruent to R modulo M
+
+template <
+    class T,
+    std::uintmax_t M,
+    std::uintmax_t R = 0,
+    class P = native,
+    class E = default_exception_policy
+>
+using safe_congruent = safe_congruent_base<
+    T,
+    std::numeric_limits<T>::min(),
+    std::numeric_limits<T>::max(),
+    M,
+    R,
+    P,
+    E
+>;
+
+// all the multiples of A representable by T.  A must be a power of two.
+template <
+    class T,
+    std::uintmax_t A,
+    class P = native,
+    class E = default_exception_policy
+>
+using safe_aligned = safe_congruent_base<
+    T,
+    std::numeric_limits<T>::min(),
+    static_cast<T>(
+        std::numeric_limits<T>::max() & ~static_cast<T>(A - 1)
+    ),
+    A,
+    0,
+    P,
+    E
+>;
+
+} // safe_numerics
+} // boost
+
+namespace std {
+
+template<
+    class T,
+    T Min,
+    T Max,
+    std::uintmax_t M,
+    std::uintmax_t R,
+    class P,
+    class E
+>
+class numeric_limits<
+    boost::safe_numerics::safe_congruent_base<T, Min, Max, M, R, P, E>
+>
+    : public std::numeric_limits<T>
+{
+    using SB = boost::safe_numerics::safe_congruent_base<T, Min, Max, M, R, P, E>;
+public:
+    constexpr static SB lowest() noexcept {
+        return SB(Min, typename SB::skip_validation());
+    }
+    constexpr static SB min() noexcept {
+        return SB(Min, typename SB::skip_validation());
+    }
+    constexpr static SB max() noexcept {
+        return SB(Max, typename SB::skip_validation());
+    }
+};
+
+} // std
+
+#endif // BOOST_NUMERIC_SAFE_CONGRUENCE_HPP
@@ -0,0 +1,360 @@
+#ifndef BOOST_NUMERIC_SAFE_CONVOLVE_HPP
+#define BOOST_NUMERIC_SAFE_CONVOLVE_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// convolution of a sequence or image of integers with a kernel whose
+// coefficients are known at compile time.  For example
+//
+//     using blur = normalized<kernel2d<3, 3, 1, 2, 1, 2, 4, 2, 1, 2, 1>, 4>;
+//     safe_convolve<blur>(image, rows, cols, result);
+//
+// The range of each result is calculated at compile time from the range
+// of the input type and the kernel coefficients with interval arithmetic
+// following the rules used by the automatic promotion policy. So the
+// convolution itself requires no checking at all.  The results are
+// produced as a safe range type with exactly this range.  If results are
+// stored in some other type, the conversion is checked only if the range
+// of that type doesn't include the range of the result.
+//
+// Only the "valid" part of the convolution is calculated.  That is, the
+// kernel is applied only where it lies entirely within the input.  As for
+// image filters, the kernel is not reflected so
+//
+//     out[i] = sum over k of c[k] * in[i + k]
+
+#include <algorithm> // min
+#include <cstddef>   // size_t
+#include <cstdint>   // intmax_t, uintmax_t
+#include <initializer_list>
+#include <limits>
+#include <type_traits>
+
+#include "safe_common.hpp"
+#include "safe_integer.hpp"
+#include "safe_integer_range.hpp"
+#include "checked_result.hpp"
+#include "checked_result_operations.hpp"
+#include "interval.hpp"
+#include "safe_compare.hpp"
+#include "utility.hpp"
+#include "native.hpp"
+#include "exception_policies.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+/////////////////////////////////////////////////////////////////
+// kernels
+
+// a kernel of Rows x Cols coefficients in row major order
+template<std::size_t Rows, std::size_t Cols, std::intmax_t ... C>
+struct kernel2d {
+    static_assert(
+        Rows * Cols == sizeof...(C) && sizeof...(C) > 0,
+        "the number of coefficients must be Rows * Cols"
+    );
+    constexpr static const std::size_t rows = Rows;
+    constexpr static const std::size_t cols = Cols;
+    constexpr static const std::size_t size = Rows * Cols;
+    // results are divided by 2^shift rounding toward minus infinity
+    constexpr static const unsigned int shift = 0;
+    constexpr static std::intmax_t coefficient(const std::size_t & i){
+        const std::intmax_t c[] = {C ...};
+        return c[i];
+    }
+};
+
+// a one dimensional kernel
+template<std::intmax_t ... C>
+using kernel = kernel2d<1, sizeof...(C), C ...>;
+
+// divide the results of the kernel K by 2^Shift
+template<class K, unsigned int Shift>
+struct normalized : public K {
+    static_assert(
+        Shift < std::numeric_limits<std::intmax_t>::digits,
+        "shift is too large"
+    );
+    constexpr static const unsigned int shift = K::shift + Shift;
+};
+
+namespace convolve_detail {
+
+template<class T, class Default>
+using policy_or = typename std::conditional<
+    std::is_void<T>::value,
+    Default,
+    T
+>::type;
+
+// the range of the results of applying kernel K to values of type T
+template<class K, class T>
+struct result_range {
+    using value_type = typename base_type<T>::type;
+    static_assert(
+        std::is_integral<value_type>::value,
+        "convolution is only implemented for integers"
+    );
+
+    constexpr static bool has_negative_coefficient(){
+        for(std::size_t i = 0; i < K::size; ++i)
+            if(K::coefficient(i) < 0)
+                return true;
+        return false;
+    }
+
+    // as for automatic, the result is unsigned only if all the
+    // operands are
+    using temp_base_type = typename std::conditional<
+        std::numeric_limits<value_type>::is_signed
+        || has_negative_coefficient(),
+        std::intmax_t,
+        std::uintmax_t
+    >::type;
+    using r_type = checked_result<temp_base_type>;
+    using r_interval_type = interval<r_type>;
+
+    // the range of the sum of the terms i ... size - 1.  Note that
+    // checked_result isn't assignable so this is done recursively.
+    constexpr static r_interval_type get(const std::size_t i = 0){
+        return i == K::size
+            ? r_interval_type(r_type(0), r_type(0))
+            : r_interval_type(
+                checked::cast<temp_base_type>(base_value(std::numeric_limits<T>::min())),
+                checked::cast<temp_base_type>(base_value(std::numeric_limits<T>::max()))
+            ) * r_interval_type(
+                checked::cast<temp_base_type>(K::coefficient(i)),
+                checked::cast<temp_base_type>(K::coefficient(i))
+            ) + get(i + 1);
+    }
+    static_assert(
+        ! get().l.exception() && ! get().u.exception(),
+        "the results of the convolution cannot be represented"
+    );
+    // before normalization
+    constexpr static const temp_base_type sum_min =
+        static_cast<temp_base_type>(get().l);
+    constexpr static const temp_base_type sum_max =
+        static_cast<temp_base_type>(get().u);
+
+    // shift rounding toward minus infinity
+    constexpr static temp_base_type normalize(const temp_base_type & x){
+        return x >= 0
+            ? static_cast<temp_base_type>(x >> K::shift)
+            : static_cast<temp_base_type>(-((-(x + 1)) >> K::shift) - 1);
+    }
+    constexpr static const temp_base_type min = normalize(sum_min);
+    constexpr static const temp_base_type max = normalize(sum_max);
+};
+
+template<
+    class K,
+    class T,
+    bool Signed = std::is_signed<typename result_range<K, T>::temp_base_type>::value
+>
+struct result_type {
+    using type = safe_signed_range<
+        static_cast<std::intmax_t>(result_range<K, T>::min),
+        static_cast<std::intmax_t>(result_range<K, T>::max),
+        policy_or<typename get_promotion_policy<T>::type, native>,
+        policy_or<typename get_exception_policy<T>::type, default_exception_policy>
+    >;
+};
+
+template<class K, class T>
+struct result_type<K, T, false> {
+    using type = safe_unsigned_range<
+        static_cast<std::uintmax_t>(result_range<K, T>::min),
+        static_cast<std::uintmax_t>(result_range<K, T>::max),
+        policy_or<typename get_promotion_policy<T>::type, native>,
+        policy_or<typename get_exception_policy<T>::type, default_exception_policy>
+    >;
+};
+
+// store a result into a variable of type R.  The conversion is checked
+// only if the range of R doesn't include that of the result.
+template<class R, class S>
+constexpr bool fits(){
+    return
+        safe_compare::less_than_equal(
+            base_value(std::numeric_limits<R>::min()),
+            base_value(std::numeric_limits<S>::min())
+        )
+        && safe_compare::less_than_equal(
+            base_value(std::numeric_limits<S>::max()),
+            base_value(std::numeric_limits<R>::max())
+        );
+}
+
+template<class R, class S>
+typename std::enable_if<is_safe<R>::value, R>::type
+store(const S & s, std::true_type){
+    return R(
+        static_cast<typename base_type<R>::type>(base_value(s)),
+        typename R::skip_validation()
+    );
+}
+template<class R, class S>
+typename std::enable_if<! is_safe<R>::value, R>::type
+store(const S & s, std::true_type){
+    return static_cast<R>(base_value(s));
+}
+template<class R, class S>
+typename std::enable_if<is_safe<R>::value, R>::type
+store(const S & s, std::false_type){
+    return R(s);
+}
+template<class R, class S>
+typename std::enable_if<! is_safe<R>::value, R>::type
+store(const S & s, std::false_type){
+    using E = typename get_exception_policy<S>::type;
+    return base_value(safe<R, native, E>(s));
+}
+
+// the outputs are calculated in tiles of this many elements.  Each
+// coefficient is applied to a whole tile with a simple loop which the
+// compiler can vectorize.
+constexpr const std::size_t tile_size = 256;
+
+template<class K, class T>
+class engine {
+    using range = result_range<K, T>;
+    using stored_type = typename base_type<T>::type;
+public:
+    using result_type = typename convolve_detail::result_type<K, T>::type;
+private:
+    using result_stored_type = typename base_type<result_type>::type;
+
+    // the smallest type which holds the sum before normalization
+    using sum_type = typename std::conditional<
+        std::is_signed<typename range::temp_base_type>::value,
+        utility::signed_stored_type<
+            static_cast<std::intmax_t>(range::sum_min),
+            static_cast<std::intmax_t>(range::sum_max)
+        >,
+        utility::unsigned_stored_type<
+            static_cast<std::uintmax_t>(range::sum_min),
+            static_cast<std::uintmax_t>(range::sum_max)
+        >
+    >::type;
+    using unsigned_sum_type = typename std::make_unsigned<sum_type>::type;
+
+    // sums are calculated with modular arithmetic.  The sum of only some
+    // of the terms may be out of the range of the result but the final
+    // sum is not so it is recovered exactly. Arithmetic is done in at
+    // least an unsigned int so that no operand is promoted to int.
+    using accumulator_type = typename std::conditional<
+        (sizeof(unsigned_sum_type) < sizeof(unsigned int)),
+        unsigned int,
+        unsigned_sum_type
+    >::type;
+
+    // add coefficient i of the kernel times the m values starting at in
+    // to the tile
+    static void accumulate(
+        accumulator_type * tile,
+        const std::size_t & i,
+        const T * in,
+        const std::size_t & m
+    ){
+        const accumulator_type c =
+            static_cast<accumulator_type>(K::coefficient(i));
+        if(c == 0)
+            return;
+        for(std::size_t j = 0; j < m; ++j)
+            tile[j] += c * static_cast<accumulator_type>(base_value(in[j]));
+    }
+
+    static result_type finish(const accumulator_type & a){
+        // the sum is in range so the conversion is exact
+        const typename range::temp_base_type s =
+            static_cast<sum_type>(static_cast<unsigned_sum_type>(a));
+        return result_type(
+            static_cast<result_stored_type>(range::normalize(s)),
+            typename result_type::skip_validation()
+        );
+    }
+
+public:
+    // the m outputs starting at out from the rows of input starting at in.
+    // Consecutive rows of input are stride elements apart.
+    template<class R>
+    static void row(
+        const T * in,
+        const std::size_t & stride,
+        R * out,
+        const std::size_t & m
+    ){
+        using fits = std::integral_constant<bool, convolve_detail::fits<R, result_type>()>;
+        accumulator_type tile[tile_size];
+        for(std::size_t first = 0; first < m; first += tile_size){
+            const std::size_t n = std::min(tile_size, m - first);
+            std::fill(tile, tile + n, accumulator_type(0));
+            for(std::size_t r = 0; r < K::rows; ++r)
+                for(std::size_t c = 0; c < K::cols; ++c)
+                    accumulate(
+                        tile,
+                        r * K::cols + c,
+                        in + r * stride + first + c,
+                        n
+                    );
+            for(std::size_t j = 0; j < n; ++j)
+                out[first + j] = store<R>(finish(tile[j]), fits());
+        }
+    }
+};
+
+} // convolve_detail
+
+// the type of the results of applying kernel K to values of type T
+template<class K, class T>
+using convolution_result_type = typename convolve_detail::engine<K, T>::result_type;
+
+// one dimensional convolution of the n values starting at in with the
+// kernel K.  n - K::cols + 1 results are stored starting at out.  The
+// number of results is returned.
+template<class K, class T, class R>
+std::size_t safe_convolve(const T * in, const std::size_t & n, R * out){
+    static_assert(K::rows == 1, "kernel must be one dimensional");
+    if(n < K::cols)
+        return 0;
+    const std::size_t m = n - K::cols + 1;
+    convolve_detail::engine<K, T>::row(in, n, out, m);
+    return m;
+}
+
+// two dimensional convolution of the image of rows x cols values stored
+// in row major order starting at in with the kernel K.  The results are
+// stored in row major order starting at out.  Each row of output has
+// cols - K::cols + 1 values and there are rows - K::rows + 1 rows.  The
+// number of results is returned.
+template<class K, class T, class R>
+std::size_t safe_convolve(
+    const T * in,
+    const std::size_t & rows,
+    const std::size_t & cols,
+    R * out
+){
+    if(rows < K::rows || cols < K::cols)
+        return 0;
+    const std::size_t out_rows = rows - K::rows + 1;
+    const std::size_t out_cols = cols - K::cols + 1;
+    for(std::size_t r = 0; r < out_rows; ++r)
+        convolve_detail::engine<K, T>::row(
+            in + r * cols,
+            cols,
+            out + r * out_cols,
+            out_cols
+        );
+    return out_rows * out_cols;
+}
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_SAFE_CONVOLVE_HPP
@@ -38,5 +38,10 @@ using safe = safe_base<
 } // safe_numerics
 } // boost
 
+// the common safe types are instantiated in the library
+// boost_safe_numerics_instantiations
+#if defined(BOOST_SAFE_NUMERICS_EXTERN_INSTANTIATIONS)
+#include "instantiations.hpp"
+#endif
 
 #endif // BOOST_NUMERIC_SAFE_INTEGER_HPP
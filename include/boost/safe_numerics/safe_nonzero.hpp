@@ -0,0 +1,266 @@
+#ifndef BOOST_NUMERIC_SAFE_NONZERO_HPP
+#define BOOST_NUMERIC_SAFE_NONZERO_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// safe integers whose set of values is [Min, Max] with the exception of
+// zero.  A divisor declared as safe<int> must be checked for zero on
+// every division.  A divisor declared as safe_nonzero<int> is checked
+// once when it is constructed or assigned and division or modulus by it
+// requires no check for zero.  Note that division may still overflow
+// as in INT_MIN / -1 unless the range of the dividend excludes the most
+// negative value.
+//
+// The type is a safe_base with the additional invariant.  The result of
+// an arithmetic operation on it is an ordinary safe type.
+
+#include <cstdint> // intmax_t
+#include <limits>
+#include <type_traits>
+
+#include <boost/config.hpp> // BOOST_UNLIKELY
+
+#include "safe_common.hpp"
+#include "safe_base.hpp"
+#include "safe_base_operations.hpp"
+#include "safe_compare.hpp"
+#include "utility.hpp"
+#include "native.hpp"
+#include "exception.hpp"
+#include "exception_policies.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+template<
+    class Stored,
+    Stored Min,
+    Stored Max,
+    class P, // promotion policy
+    class E  // exception policy
+>
+class safe_nonzero_base : public safe_base<Stored, Min, Max, P, E> {
+    static_assert(
+        Min != 0 && Max != 0,
+        "the bounds of a nonzero range must not be zero"
+    );
+    using base_t = safe_base<Stored, Min, Max, P, E>;
+
+    // the check is only required if the source type can hold zero
+    template<class T>
+    constexpr static bool zero_possible(){
+        return
+            safe_compare::less_than_equal(
+                base_value(std::numeric_limits<T>::min()), 0
+            )
+            && safe_compare::greater_than_equal(
+                base_value(std::numeric_limits<T>::max()), 0
+            );
+    }
+    constexpr static const base_t & validated(const base_t & t, std::false_type){
+        return t;
+    }
+    constexpr static const base_t & validated(const base_t & t, std::true_type){
+        if(BOOST_UNLIKELY(static_cast<Stored>(t) == 0))
+            dispatch<E, safe_numerics_error::range_error>(
+                "value must not be zero"
+            );
+        return t;
+    }
+    template<class T>
+    constexpr static base_t validated(const T & t){
+        return validated(
+            base_t(t),
+            std::integral_constant<bool, zero_possible<T>()>()
+        );
+    }
+
+public:
+    using skip_validation = typename base_t::skip_validation;
+
+    constexpr safe_nonzero_base() = default;
+
+    constexpr explicit safe_nonzero_base(const Stored & t, skip_validation) :
+        base_t(t, skip_validation())
+    {}
+
+    template<
+        class T,
+        typename std::enable_if<
+            std::is_convertible<T, Stored>::value,
+            bool
+        >::type = 0
+    >
+    constexpr /*explicit*/ safe_nonzero_base(const T & t) :
+        base_t(validated(t))
+    {}
+
+    template<typename T, T N, class Px, class Ex>
+    constexpr /*explicit*/ safe_nonzero_base(
+        const safe_literal_impl<T, N, Px, Ex> & t
+    ) :
+        base_t(validated(t))
+    {}
+
+    constexpr safe_nonzero_base(const safe_nonzero_base &) = default;
+    constexpr safe_nonzero_base & operator=(const safe_nonzero_base &) = default;
+    constexpr safe_nonzero_base(safe_nonzero_base &&) = default;
+    constexpr safe_nonzero_base & operator=(safe_nonzero_base &&) = default;
+
+    template<class T>
+    constexpr safe_nonzero_base & operator=(const T & rhs){
+        base_t::operator=(validated(rhs));
+        return *this;
+    }
+
+    // the mutating operators of safe_base would bypass the check
+    safe_nonzero_base & operator++(){
+        return *this = *this + 1;
+    }
+    safe_nonzero_base & operator--(){
+        return *this = *this - 1;
+    }
+    safe_nonzero_base operator++(int){
+        const safe_nonzero_base old_t = *this;
+        ++(*this);
+        return old_t;
+    }
+    safe_nonzero_base operator--(int){
+        const safe_nonzero_base old_t = *this;
+        --(*this);
+        return old_t;
+    }
+};
+
+template<
+    class T,
+    T Min,
+    T Max,
+    class P,
+    class E
+>
+struct is_safe<safe_nonzero_base<T, Min, Max, P, E> > : public std::true_type
+{};
+
+template<
+    class T,
+    T Min,
+    T Max,
+    class P,
+    class E
+>
+struct excludes_zero<safe_nonzero_base<T, Min, Max, P, E> > : public std::true_type
+{};
+
+template<
+    class T,
+    T Min,
+    T Max,
+    class P,
+    class E
+>
+struct get_promotion_policy<safe_nonzero_base<T, Min, Max, P, E> > {
+    using type = P;
+};
+
+template<
+    class T,
+    T Min,
+    T Max,
+    class P,
+    class E
+>
+struct get_exception_policy<safe_nonzero_base<T, Min, Max, P, E> > {
+    using type = E;
+};
+
+template<
+    class T,
+    T Min,
+    T Max,
+    class P,
+    class E
+>
+struct base_type<safe_nonzero_base<T, Min, Max, P, E> > {
+    using type = T;
+};
+
+template<
+    class T,
+    T Min,
+    T Max,
+    class P,
+    class E
+>
+constexpr T base_value(
+    const safe_nonzero_base<T, Min, Max, P, E>  & st
+) {
+    return static_cast<T>(st);
+}
+
+/////////////////////////////////////////////////////////////////
+// all the values of T except zero
+
+template <
+    class T,
+    class P = native,
+    class E = default_exception_policy
+>
+using safe_nonzero = safe_nonzero_base<
+    T,
+    std::numeric_limits<T>::min() == 0 ? 1 : std::numeric_limits<T>::min(),
+    std::numeric_limits<T>::max(),
+    P,
+    E
+>;
+
+// the values [Min, -1] and [1, Max]
+template <
+    std::intmax_t Min,
+    std::intmax_t Max,
+    class P = native,
+    class E = default_exception_policy
+>
+using safe_nonzero_range = safe_nonzero_base<
+    typename utility::signed_stored_type<Min, Max>,
+    static_cast<typename utility::signed_stored_type<Min, Max> >(Min),
+    static_cast<typename utility::signed_stored_type<Min, Max> >(Max),
+    P,
+    E
+>;
+
+} // safe_numerics
+} // boost
+
+namespace std {
+
+template<
+    class T,
+    T Min,
+    T Max,
+    class P,
+    class E
+>
+class numeric_limits<boost::safe_numerics::safe_nonzero_base<T, Min, Max, P, E> >
+    : public std::numeric_limits<T>
+{
+    using SB = boost::safe_numerics::safe_nonzero_base<T, Min, Max, P, E>;
+public:
+    constexpr static SB lowest() noexcept {
+        return SB(Min, typename SB::skip_validation());
+    }
+    constexpr static SB min() noexcept {
+        return SB(Min, typename SB::skip_validation());
+    }
+    constexpr static SB max() noexcept {
+        return SB(Max, typename SB::skip_validation());
+    }
+};
+
+} // std
+
+#endif // BOOST_NUMERIC_SAFE_NONZERO_HPP
@@ -0,0 +1,255 @@
+#ifndef BOOST_NUMERIC_SAFE_RANGE_MAP_HPP
+#define BOOST_NUMERIC_SAFE_RANGE_MAP_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// an associative container whose key is a safe integer type with a small
+// range such as safe_unsigned_range<0, 4095>.  Values are held in a flat
+// array indexed directly by the key.  Which slots are occupied is recorded
+// in a safe_range_set.  Only occupied slots hold constructed values so V
+// need not be default constructible.
+
+#include <cstddef>   // size_t
+#include <iterator>  // forward_iterator_tag
+#include <memory>    // unique_ptr
+#include <new>       // placement new
+#include <stdexcept> // out_of_range
+#include <type_traits>
+#include <utility>   // forward, move, pair
+
+#include "safe_range_set.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+template<class KeyT, class V>
+class safe_range_map {
+    using traits = range_key_traits<KeyT>;
+    constexpr static const std::size_t N = safe_range_set<KeyT>::capacity();
+
+    using slot_type = typename std::aligned_storage<sizeof(V), alignof(V)>::type;
+
+    safe_range_set<KeyT> m_keys;
+    std::unique_ptr<slot_type[]> m_slots;
+
+    constexpr static std::size_t index(const KeyT & k){
+        return static_cast<std::size_t>(traits::offset(k));
+    }
+    V * slot(const std::size_t & i){
+        return reinterpret_cast<V *>(& m_slots[i]);
+    }
+    const V * slot(const std::size_t & i) const {
+        return reinterpret_cast<const V *>(& m_slots[i]);
+    }
+    void destroy_all(){
+        for(const KeyT & k : m_keys)
+            slot(index(k))->~V();
+        m_keys.clear();
+    }
+
+public:
+    using key_type = KeyT;
+    using mapped_type = V;
+    using size_type = std::size_t;
+
+    // iterators return a pair of the key and a reference to the value
+    template<class VR>
+    struct reference_type {
+        const KeyT first;
+        VR & second;
+    };
+    using reference = reference_type<V>;
+    using const_reference = reference_type<const V>;
+
+    template<class Map, class VR>
+    class iterator_type {
+        Map * m_map;
+        typename safe_range_set<KeyT>::const_iterator m_i;
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const KeyT, V>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = reference_type<VR>;
+
+        iterator_type(
+            Map * map,
+            const typename safe_range_set<KeyT>::const_iterator & i
+        ) :
+            m_map(map),
+            m_i(i)
+        {}
+        reference operator*() const {
+            const KeyT k = *m_i;
+            return reference{k, *m_map->slot(index(k))};
+        }
+        iterator_type & operator++(){
+            ++m_i;
+            return *this;
+        }
+        iterator_type operator++(int){
+            const iterator_type old_i = *this;
+            ++m_i;
+            return old_i;
+        }
+        bool operator==(const iterator_type & rhs) const {
+            return m_i == rhs.m_i;
+        }
+        bool operator!=(const iterator_type & rhs) const {
+            return m_i != rhs.m_i;
+        }
+    };
+    using iterator = iterator_type<safe_range_map, V>;
+    using const_iterator = iterator_type<const safe_range_map, const V>;
+
+    safe_range_map() :
+        m_slots(new slot_type[N])
+    {}
+    safe_range_map(const safe_range_map & rhs) :
+        m_slots(new slot_type[N])
+    {
+        // if a copy throws, destroy the values already copied as the
+        // destructor won't be called
+        try{
+            for(const KeyT & k : rhs.m_keys){
+                const std::size_t i = index(k);
+                new(slot(i)) V(*rhs.slot(i));
+                m_keys.insert(k);
+            }
+        }
+        catch(...){
+            destroy_all();
+            throw;
+        }
+    }
+    safe_range_map(safe_range_map && rhs) :
+        m_keys(rhs.m_keys),
+        m_slots(std::move(rhs.m_slots))
+    {
+        rhs.m_keys.clear();
+        rhs.m_slots.reset(new slot_type[N]);
+    }
+    safe_range_map & operator=(const safe_range_map & rhs){
+        if(this != & rhs){
+            safe_range_map tmp(rhs);
+            swap(tmp);
+        }
+        return *this;
+    }
+    safe_range_map & operator=(safe_range_map && rhs){
+        swap(rhs);
+        return *this;
+    }
+    ~safe_range_map(){
+        if(m_slots)
+            destroy_all();
+    }
+    void swap(safe_range_map & rhs){
+        std::swap(m_keys, rhs.m_keys);
+        std::swap(m_slots, rhs.m_slots);
+    }
+
+    // the number of distinct values the key type can take on
+    constexpr static size_type capacity(){
+        return N;
+    }
+
+    // construct the value in place if the key is not already present.
+    // returns true if the value was inserted
+    template<class... Args>
+    std::pair<iterator, bool> emplace(const KeyT & k, Args && ... args){
+        const std::size_t i = index(k);
+        const bool inserted = ! m_keys.contains(k);
+        if(inserted){
+            new(slot(i)) V(std::forward<Args>(args)...);
+            m_keys.insert(k);
+        }
+        return std::pair<iterator, bool>(iterator(this, m_keys.find(k)), inserted);
+    }
+    std::pair<iterator, bool> insert(const KeyT & k, const V & v){
+        return emplace(k, v);
+    }
+    // replace any existing value
+    std::pair<iterator, bool> insert_or_assign(const KeyT & k, const V & v){
+        if(m_keys.contains(k)){
+            *slot(index(k)) = v;
+            return std::pair<iterator, bool>(iterator(this, m_keys.find(k)), false);
+        }
+        return emplace(k, v);
+    }
+    // default construct the value if the key is not present
+    V & operator[](const KeyT & k){
+        const std::size_t i = index(k);
+        if(! m_keys.contains(k)){
+            new(slot(i)) V();
+            m_keys.insert(k);
+        }
+        return *slot(i);
+    }
+    V & at(const KeyT & k){
+        if(! m_keys.contains(k))
+            throw std::out_of_range("safe_range_map::at - key not present");
+        return *slot(index(k));
+    }
+    const V & at(const KeyT & k) const {
+        if(! m_keys.contains(k))
+            throw std::out_of_range("safe_range_map::at - key not present");
+        return *slot(index(k));
+    }
+    // returns the number of elements removed
+    size_type erase(const KeyT & k){
+        if(! m_keys.contains(k))
+            return 0;
+        slot(index(k))->~V();
+        m_keys.erase(k);
+        return 1;
+    }
+    void clear(){
+        destroy_all();
+    }
+    bool contains(const KeyT & k) const {
+        return m_keys.contains(k);
+    }
+    size_type count(const KeyT & k) const {
+        return m_keys.count(k);
+    }
+    iterator find(const KeyT & k){
+        return iterator(this, m_keys.find(k));
+    }
+    const_iterator find(const KeyT & k) const {
+        return const_iterator(this, m_keys.find(k));
+    }
+    size_type size() const {
+        return m_keys.size();
+    }
+    bool empty() const {
+        return m_keys.empty();
+    }
+    // the set of keys present. Can be used with the set operations
+    // of safe_range_set
+    const safe_range_set<KeyT> & keys() const {
+        return m_keys;
+    }
+
+    iterator begin(){
+        return iterator(this, m_keys.begin());
+    }
+    iterator end(){
+        return iterator(this, m_keys.end());
+    }
+    const_iterator begin() const {
+        return const_iterator(this, m_keys.begin());
+    }
+    const_iterator end() const {
+        return const_iterator(this, m_keys.end());
+    }
+};
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_SAFE_RANGE_MAP_HPP
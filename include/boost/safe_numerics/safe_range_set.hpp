@@ -0,0 +1,286 @@
+#ifndef BOOST_NUMERIC_SAFE_RANGE_SET_HPP
+#define BOOST_NUMERIC_SAFE_RANGE_SET_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// a set of values of a safe integer type such as safe_unsigned_range<0, 4095>
+// implemented as a bitset indexed directly by the value.  Since the type of
+// the key guarantees that its value is in [Min, Max], the size of the bitset
+// is fixed at compile time and no hashing, probing or bounds checking
+// is required.
+
+#include <cstdint>   // uint64_t
+#include <cstddef>   // size_t
+#include <iterator>  // forward_iterator_tag
+#include <limits>
+
+#include "range_key.hpp"
+#include "utility.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+/////////////////////////////////////////////////////////////////
+// fixed size bitset. Set operations are implemented as loops over
+// arrays of 64 bit words with no dependencies between iterations so
+// that compilers are free to vectorize them.
+
+template<std::size_t N>
+class range_bitset {
+    using word_type = std::uint64_t;
+    constexpr static const std::size_t word_bits = 64;
+    constexpr static const std::size_t word_count = (N + word_bits - 1) / word_bits;
+
+    word_type m_words[word_count];
+
+    constexpr static word_type mask(const std::size_t & i){
+        return word_type(1) << (i % word_bits);
+    }
+
+public:
+    constexpr range_bitset() :
+        m_words{}
+    {}
+
+    constexpr bool test(const std::size_t & i) const {
+        return (m_words[i / word_bits] & mask(i)) != 0;
+    }
+    void set(const std::size_t & i){
+        m_words[i / word_bits] |= mask(i);
+    }
+    void reset(const std::size_t & i){
+        m_words[i / word_bits] &= ~mask(i);
+    }
+    void clear(){
+        for(std::size_t i = 0; i < word_count; ++i)
+            m_words[i] = 0;
+    }
+    std::size_t count() const {
+        std::size_t c = 0;
+        for(std::size_t i = 0; i < word_count; ++i)
+            c += utility::popcount(m_words[i]);
+        return c;
+    }
+    bool none() const {
+        word_type w = 0;
+        for(std::size_t i = 0; i < word_count; ++i)
+            w |= m_words[i];
+        return w == 0;
+    }
+    // return the index of the first bit set at or after i.  If there
+    // is none, return N
+    std::size_t find_next(std::size_t i) const {
+        if(i >= N)
+            return N;
+        std::size_t w = i / word_bits;
+        word_type bits = m_words[w] & (~word_type(0) << (i % word_bits));
+        while(bits == 0){
+            if(++w == word_count)
+                return N;
+            bits = m_words[w];
+        }
+        return w * word_bits + utility::countr_zero(bits);
+    }
+
+    range_bitset & operator|=(const range_bitset & rhs){
+        for(std::size_t i = 0; i < word_count; ++i)
+            m_words[i] |= rhs.m_words[i];
+        return *this;
+    }
+    range_bitset & operator&=(const range_bitset & rhs){
+        for(std::size_t i = 0; i < word_count; ++i)
+            m_words[i] &= rhs.m_words[i];
+        return *this;
+    }
+    range_bitset & operator^=(const range_bitset & rhs){
+        for(std::size_t i = 0; i < word_count; ++i)
+            m_words[i] ^= rhs.m_words[i];
+        return *this;
+    }
+    // set difference
+    range_bitset & operator-=(const range_bitset & rhs){
+        for(std::size_t i = 0; i < word_count; ++i)
+            m_words[i] &= ~rhs.m_words[i];
+        return *this;
+    }
+    bool operator==(const range_bitset & rhs) const {
+        word_type w = 0;
+        for(std::size_t i = 0; i < word_count; ++i)
+            w |= m_words[i] ^ rhs.m_words[i];
+        return w == 0;
+    }
+    // true if every bit set in this is also set in rhs
+    bool is_subset_of(const range_bitset & rhs) const {
+        word_type w = 0;
+        for(std::size_t i = 0; i < word_count; ++i)
+            w |= m_words[i] & ~rhs.m_words[i];
+        return w == 0;
+    }
+};
+
+/////////////////////////////////////////////////////////////////
+// set of values of a safe integer type
+
+// the largest number of values of a key type which may be directly
+// addressed.  A set of them occupies 8 KiB.  A larger range would make
+// a set too large to be an object and a map too large to allocate.
+constexpr const std::uintmax_t range_set_max_size = std::uintmax_t(1) << 16;
+
+template<class KeyT>
+class safe_range_set {
+    using traits = range_key_traits<KeyT>;
+    static_assert(
+        traits::span < range_set_max_size,
+        "the range of the key type is too large to be directly addressed"
+    );
+    constexpr static const std::size_t N = static_cast<std::size_t>(traits::span) + 1;
+
+    range_bitset<N> m_bits;
+
+    constexpr static std::size_t index(const KeyT & k){
+        return static_cast<std::size_t>(traits::offset(k));
+    }
+
+public:
+    using key_type = KeyT;
+    using value_type = KeyT;
+    using size_type = std::size_t;
+
+    // iteration visits the keys in increasing order
+    class const_iterator {
+        const range_bitset<N> * m_bits;
+        std::size_t m_i;
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = KeyT;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const KeyT *;
+        using reference = KeyT;
+
+        const_iterator(const range_bitset<N> * bits, std::size_t i) :
+            m_bits(bits),
+            m_i(i)
+        {}
+        KeyT operator*() const {
+            return traits::key(m_i);
+        }
+        const_iterator & operator++(){
+            m_i = m_bits->find_next(m_i + 1);
+            return *this;
+        }
+        const_iterator operator++(int){
+            const const_iterator old_i = *this;
+            ++(*this);
+            return old_i;
+        }
+        bool operator==(const const_iterator & rhs) const {
+            return m_i == rhs.m_i;
+        }
+        bool operator!=(const const_iterator & rhs) const {
+            return m_i != rhs.m_i;
+        }
+    };
+    using iterator = const_iterator;
+
+    // the number of distinct values the key type can take on
+    constexpr static size_type capacity(){
+        return N;
+    }
+
+    // returns true if the key was not already present
+    bool insert(const KeyT & k){
+        const std::size_t i = index(k);
+        const bool inserted = ! m_bits.test(i);
+        m_bits.set(i);
+        return inserted;
+    }
+    // returns the number of elements removed
+    size_type erase(const KeyT & k){
+        const std::size_t i = index(k);
+        const bool erased = m_bits.test(i);
+        m_bits.reset(i);
+        return erased ? 1 : 0;
+    }
+    bool contains(const KeyT & k) const {
+        return m_bits.test(index(k));
+    }
+    size_type count(const KeyT & k) const {
+        return contains(k) ? 1 : 0;
+    }
+    const_iterator find(const KeyT & k) const {
+        const std::size_t i = index(k);
+        return const_iterator(&m_bits, m_bits.test(i) ? i : N);
+    }
+    void clear(){
+        m_bits.clear();
+    }
+    // note: size is computed by counting the bits.  This is
+    // proportional to capacity() / 64 rather than constant time.
+    size_type size() const {
+        return m_bits.count();
+    }
+    bool empty() const {
+        return m_bits.none();
+    }
+
+    const_iterator begin() const {
+        return const_iterator(&m_bits, m_bits.find_next(0));
+    }
+    const_iterator end() const {
+        return const_iterator(&m_bits, N);
+    }
+
+    // set operations
+    safe_range_set & operator|=(const safe_range_set & rhs){
+        m_bits |= rhs.m_bits;
+        return *this;
+    }
+    safe_range_set & operator&=(const safe_range_set & rhs){
+        m_bits &= rhs.m_bits;
+        return *this;
+    }
+    safe_range_set & operator^=(const safe_range_set & rhs){
+        m_bits ^= rhs.m_bits;
+        return *this;
+    }
+    safe_range_set & operator-=(const safe_range_set & rhs){
+        m_bits -= rhs.m_bits;
+        return *this;
+    }
+    friend safe_range_set
+    operator|(safe_range_set lhs, const safe_range_set & rhs){
+        return lhs |= rhs;
+    }
+    friend safe_range_set
+    operator&(safe_range_set lhs, const safe_range_set & rhs){
+        return lhs &= rhs;
+    }
+    friend safe_range_set
+    operator^(safe_range_set lhs, const safe_range_set & rhs){
+        return lhs ^= rhs;
+    }
+    friend safe_range_set
+    operator-(safe_range_set lhs, const safe_range_set & rhs){
+        return lhs -= rhs;
+    }
+    friend bool
+    operator==(const safe_range_set & lhs, const safe_range_set & rhs){
+        return lhs.m_bits == rhs.m_bits;
+    }
+    friend bool
+    operator!=(const safe_range_set & lhs, const safe_range_set & rhs){
+        return ! (lhs == rhs);
+    }
+    bool is_subset_of(const safe_range_set & rhs) const {
+        return m_bits.is_subset_of(rhs.m_bits);
+    }
+};
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_SAFE_RANGE_SET_HPP
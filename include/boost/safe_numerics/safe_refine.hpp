@@ -0,0 +1,161 @@
+#ifndef BOOST_NUMERIC_SAFE_REFINE_HPP
+#define BOOST_NUMERIC_SAFE_REFINE_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// narrow a value to a range type after a run time test.  After
+//
+//     if(x >= 0 && x < 100) ...
+//
+// the compiler knows the range of x but the type of x doesn't so any
+// arithmetic on x is still checked.  Instead
+//
+//     if(const auto r = safe_refine<0, 99>(x))
+//         ... *r * 3 ...
+//
+// the value *r has the type safe_signed_range<0, 99> so that the
+// arithmetic on it is checked (if at all) against the narrower range.
+// The test is a single comparison of the offset x - Min with the span
+// Max - Min calculated with unsigned arithmetic.
+//
+// refine_or<Min, Max>(x, fallback) returns the refined value or the
+// fallback if x is not in the range.
+
+#include <cstdint> // intmax_t, uintmax_t
+#include <limits>
+#include <type_traits>
+
+#include <boost/config.hpp> // BOOST_UNLIKELY
+
+#include "safe_common.hpp"
+#include "safe_compare.hpp"
+#include "safe_integer_range.hpp"
+#include "native.hpp"
+#include "exception.hpp"
+#include "exception_policies.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+namespace refine_detail {
+
+// plain integers are refined to safe types with the default policies
+template<class P, class Default>
+using policy_or = typename std::conditional<
+    std::is_void<P>::value,
+    Default,
+    P
+>::type;
+
+template<std::intmax_t Min, std::intmax_t Max, class T>
+struct refined_type {
+    using value_type = typename base_type<T>::type;
+    static_assert(
+        std::is_integral<value_type>::value,
+        "only integers can be refined"
+    );
+    static_assert(Min <= Max, "the range is empty");
+    using P = policy_or<typename get_promotion_policy<T>::type, native>;
+    using E = policy_or<
+        typename get_exception_policy<T>::type,
+        default_exception_policy
+    >;
+    // the refined value is signed if the original is or if the range
+    // includes negative values
+    using type = typename std::conditional<
+        std::is_signed<value_type>::value || Min < 0,
+        safe_signed_range<Min, Max, P, E>,
+        safe_unsigned_range<
+            static_cast<std::uintmax_t>(Min),
+            static_cast<std::uintmax_t>(Max),
+            P,
+            E
+        >
+    >::type;
+};
+
+// true if Min <= t <= Max.  This is a single comparison of the offset
+// from Min unless an unsigned value could alias a negative bound.
+template<std::intmax_t Min, std::intmax_t Max, class T>
+constexpr bool in_range(const T & t){
+    return safe_compare::in_range(t, Min, Max);
+}
+
+} // refine_detail
+
+// the result of a refinement - either a value of the range type R or
+// nothing.  The interface follows that of std::optional.
+template<class R>
+class refinement {
+    using stored_type = typename base_type<R>::type;
+    using E = typename get_exception_policy<R>::type;
+
+    // an empty refinement holds the minimum of the range so that the
+    // stored value is always valid
+    stored_type m_t;
+    bool m_valid;
+
+public:
+    using value_type = R;
+
+    constexpr refinement() :
+        m_t(base_value(std::numeric_limits<R>::min())),
+        m_valid(false)
+    {}
+    constexpr refinement(const stored_type & t, bool valid) :
+        m_t(t),
+        m_valid(valid)
+    {}
+
+    constexpr bool has_value() const {
+        return m_valid;
+    }
+    constexpr explicit operator bool () const {
+        return m_valid;
+    }
+    // the refinement must have a value
+    constexpr R operator*() const {
+        return R(m_t, typename R::skip_validation());
+    }
+    // an empty refinement is reported through the exception policy
+    constexpr R value() const {
+        if(BOOST_UNLIKELY(! m_valid))
+            dispatch<E, safe_numerics_error::range_error>(
+                "refined value is not in range"
+            );
+        return R(m_t, typename R::skip_validation());
+    }
+    constexpr R value_or(const R & fallback) const {
+        return m_valid ? R(m_t, typename R::skip_validation()) : fallback;
+    }
+};
+
+template<std::intmax_t Min, std::intmax_t Max, class T>
+constexpr refinement<typename refine_detail::refined_type<Min, Max, T>::type>
+safe_refine(const T & t){
+    using result_type = typename refine_detail::refined_type<Min, Max, T>::type;
+    using stored_type = typename base_type<result_type>::type;
+    const typename base_type<T>::type x = base_value(t);
+    return refine_detail::in_range<Min, Max>(x)
+        ? refinement<result_type>(static_cast<stored_type>(x), true)
+        : refinement<result_type>();
+}
+
+// the fallback is converted to the refined type and so is checked unless
+// it is known to be in range at compile time.
+template<std::intmax_t Min, std::intmax_t Max, class T, class U>
+constexpr typename refine_detail::refined_type<Min, Max, T>::type
+refine_or(const T & t, const U & fallback){
+    using result_type = typename refine_detail::refined_type<Min, Max, T>::type;
+    const refinement<result_type> r = safe_refine<Min, Max>(t);
+    return r ? *r : result_type(fallback);
+}
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_SAFE_REFINE_HPP
@@ -0,0 +1,191 @@
+#ifndef BOOST_NUMERIC_SAFE_SERIAL_HPP
+#define BOOST_NUMERIC_SAFE_SERIAL_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// serial number arithmetic as described in RFC 1982.  Sequence numbers
+// and generation counters are expected to wrap around.  So unlike safe<T>
+// incrementing a serial number never traps. But comparing two serial
+// numbers is only meaningful if they lie within half the number space of
+// each other.  Any attempt to compare or measure the distance between
+// two serial numbers which are not so related is reported through the
+// exception policy.
+
+#include <limits>
+#include <type_traits> // is_unsigned, make_signed
+#include <istream>
+#include <ostream>
+
+#include <boost/config.hpp> // BOOST_UNLIKELY
+
+#include "safe_integer.hpp"
+#include "exception.hpp"
+#include "exception_policies.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+template<
+    class T,
+    class E = default_exception_policy
+>
+class safe_serial {
+    static_assert(
+        std::is_integral<T>::value
+        && std::is_unsigned<T>::value
+        && ! std::is_same<T, bool>::value,
+        "serial numbers must be implemented with unsigned integers"
+    );
+
+    using signed_type = typename std::make_signed<T>::type;
+
+    // the number 2^(SERIAL_BITS - 1) in the terminology of RFC 1982. Two
+    // serial numbers this far apart cannot be ordered.
+    constexpr static const T half = static_cast<T>(
+        T(1) << (std::numeric_limits<T>::digits - 1)
+    );
+
+    T m_t;
+
+    // difference (t - u) reduced modulo 2^SERIAL_BITS. Note that the
+    // arithmetic is done in the promoted type so the cast is necessary.
+    constexpr static T difference(const T & t, const T & u){
+        return static_cast<T>(t - u);
+    }
+
+    constexpr static T check_window(const T & d){
+        if(BOOST_UNLIKELY(d == half))
+            dispatch<E, safe_numerics_error::range_error>(
+                "serial numbers are too far apart to be compared"
+            );
+        return d;
+    }
+
+public:
+    using value_type = T;
+
+    // an increment must be less than half the number space
+    using increment_type = safe_base<
+        T,
+        static_cast<T>(0),
+        static_cast<T>(half - 1),
+        native,
+        E
+    >;
+
+    // the distance between two comparable serial numbers. Since two
+    // serial numbers half the number space apart are not comparable,
+    // the range is symmetric.
+    using distance_type = safe_base<
+        signed_type,
+        static_cast<signed_type>(- static_cast<signed_type>(half - 1)),
+        static_cast<signed_type>(half - 1),
+        native,
+        E
+    >;
+
+    // every value of T is a valid serial number so no validation is
+    // required on construction.
+    constexpr explicit safe_serial(const T & t = 0) :
+        m_t(t)
+    {}
+
+    constexpr explicit operator T () const {
+        return m_t;
+    }
+
+    // increment - wraps by definition
+    safe_serial & operator++(){
+        m_t = static_cast<T>(m_t + 1u);
+        return *this;
+    }
+    safe_serial operator++(int){
+        const safe_serial old_t = *this;
+        ++(*this);
+        return old_t;
+    }
+    // addition of an increment - also wraps.  The increment is validated
+    // on conversion to increment_type unless its type already guarantees
+    // that it is in range.
+    safe_serial & operator+=(const increment_type & n){
+        m_t = static_cast<T>(m_t + base_value(n));
+        return *this;
+    }
+    friend constexpr safe_serial
+    operator+(const safe_serial & t, const increment_type & n){
+        return safe_serial(static_cast<T>(t.m_t + base_value(n)));
+    }
+
+    // the signed distance from t to u. That is the value d such that
+    // t + d == u.
+    friend constexpr distance_type
+    distance(const safe_serial & t, const safe_serial & u){
+        return distance_type(
+            static_cast<signed_type>(check_window(difference(u.m_t, t.m_t))),
+            typename distance_type::skip_validation()
+        );
+    }
+
+    // comparison. The sign bit of the modular difference determines the
+    // order so no branch is required in the normal case.
+    friend constexpr bool
+    operator<(const safe_serial & t, const safe_serial & u){
+        return static_cast<signed_type>(
+            check_window(difference(t.m_t, u.m_t))
+        ) < 0;
+    }
+    friend constexpr bool
+    operator>(const safe_serial & t, const safe_serial & u){
+        return u < t;
+    }
+    friend constexpr bool
+    operator<=(const safe_serial & t, const safe_serial & u){
+        return ! (u < t);
+    }
+    friend constexpr bool
+    operator>=(const safe_serial & t, const safe_serial & u){
+        return ! (t < u);
+    }
+    // equality is defined for all pairs of serial numbers
+    friend constexpr bool
+    operator==(const safe_serial & t, const safe_serial & u){
+        return t.m_t == u.m_t;
+    }
+    friend constexpr bool
+    operator!=(const safe_serial & t, const safe_serial & u){
+        return t.m_t != u.m_t;
+    }
+
+    // stream support
+
+    template<class CharT, class Traits>
+    friend std::basic_ostream<CharT, Traits> &
+    operator<<(
+        std::basic_ostream<CharT, Traits> & os,
+        const safe_serial & t
+    ){
+        // make sure that 8 bit serial numbers print as numbers
+        return os << +t.m_t;
+    }
+
+    template<class CharT, class Traits>
+    friend std::basic_istream<CharT, Traits> &
+    operator>>(
+        std::basic_istream<CharT, Traits> & is,
+        safe_serial & t
+    ){
+        safe<T, native, E> x(t.m_t);
+        is >> x;
+        t.m_t = base_value(x);
+        return is;
+    }
+};
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_SAFE_SERIAL_HPP
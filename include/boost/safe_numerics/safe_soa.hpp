@@ -0,0 +1,319 @@
+#ifndef BOOST_NUMERIC_SAFE_SOA_HPP
+#define BOOST_NUMERIC_SAFE_SOA_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// a sequence of records whose fields are safe integer types stored as a
+// "structure of arrays".  For example
+//
+//     safe_soa<
+//         safe_unsigned_range<0, 255>,    // stored as std::uint8_t
+//         safe_signed_range<-1000, 1000>, // stored as std::int16_t
+//         safe<std::int32_t>
+//     > records;
+//
+// Each field is held in its own contiguous column of the type used to
+// store the safe type.  Since the range of a safe range type determines
+// the narrowest type which can hold it, there is no padding and each
+// column can be processed by vectorized loops such as those of
+// batch_evaluate.
+//
+// Values in the columns are always within the range of their fields.
+// Rows are accessed through proxy references whose accessors return
+// and accept the field types.  Only values which are not already known
+// to be in range are checked.
+
+#include <algorithm> // min
+#include <cstddef>   // size_t
+#include <initializer_list>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>   // index_sequence
+#include <vector>
+
+#include "safe_common.hpp"
+#include "safe_compare.hpp"
+#include "batch.hpp" // block_bounds, batch_block_size
+
+namespace boost {
+namespace safe_numerics {
+
+// a read only view of a column
+template<class T>
+class soa_column {
+    const T * m_data;
+    std::size_t m_size;
+public:
+    using value_type = T;
+    constexpr soa_column(const T * data, const std::size_t & size) :
+        m_data(data),
+        m_size(size)
+    {}
+    constexpr const T * data() const {
+        return m_data;
+    }
+    constexpr std::size_t size() const {
+        return m_size;
+    }
+    constexpr bool empty() const {
+        return m_size == 0;
+    }
+    constexpr const T * begin() const {
+        return m_data;
+    }
+    constexpr const T * end() const {
+        return m_data + m_size;
+    }
+    constexpr const T & operator[](const std::size_t & i) const {
+        return m_data[i];
+    }
+};
+
+namespace soa_detail {
+
+// true if every value of type T is in the range of F
+template<class F, class T>
+constexpr bool includes(){
+    return
+        safe_compare::less_than_equal(
+            base_value(std::numeric_limits<F>::min()),
+            base_value(std::numeric_limits<T>::min())
+        )
+        && safe_compare::less_than_equal(
+            base_value(std::numeric_limits<T>::max()),
+            base_value(std::numeric_limits<F>::max())
+        );
+}
+
+template<class F, class S>
+constexpr bool in_range(const std::pair<S, S> & bounds){
+    return
+        safe_compare::less_than_equal(
+            base_value(std::numeric_limits<F>::min()),
+            bounds.first
+        )
+        && safe_compare::less_than_equal(
+            bounds.second,
+            base_value(std::numeric_limits<F>::max())
+        );
+}
+
+template<class F, class S>
+constexpr typename std::enable_if<is_safe<F>::value, F>::type
+make_field(const S & s){
+    return F(s, typename F::skip_validation());
+}
+template<class F, class S>
+constexpr typename std::enable_if<! is_safe<F>::value, F>::type
+make_field(const S & s){
+    return s;
+}
+
+} // soa_detail
+
+template<class ... Fields>
+class safe_soa {
+    static_assert(sizeof...(Fields) > 0, "a record must have at least one field");
+
+public:
+    template<std::size_t I>
+    using field_type = typename std::tuple_element<I, std::tuple<Fields ...>>::type;
+    // the type in which the values of field I are stored
+    template<std::size_t I>
+    using stored_type = typename base_type<field_type<I>>::type;
+
+    using value_type = std::tuple<Fields ...>;
+    using size_type = std::size_t;
+    constexpr static const std::size_t field_count = sizeof...(Fields);
+
+private:
+    using sequence = std::index_sequence_for<Fields ...>;
+
+    std::tuple<std::vector<typename base_type<Fields>::type> ...> m_columns;
+
+    template<std::size_t I>
+    std::vector<stored_type<I>> & column_vector(){
+        return std::get<I>(m_columns);
+    }
+    template<std::size_t I>
+    const std::vector<stored_type<I>> & column_vector() const {
+        return std::get<I>(m_columns);
+    }
+
+    template<class F, std::size_t ... Is>
+    void for_each_column(F f, std::index_sequence<Is ...>){
+        (void)std::initializer_list<int>{(f(column_vector<Is>()), 0) ...};
+    }
+
+    template<std::size_t ... Is>
+    value_type row(const std::size_t & i, std::index_sequence<Is ...>) const {
+        return value_type(get<Is>(i) ...);
+    }
+    template<std::size_t ... Is>
+    void assign(
+        const std::size_t & i,
+        const value_type & t,
+        std::index_sequence<Is ...>
+    ){
+        (void)std::initializer_list<int>{
+            (column_vector<Is>()[i] = base_value(std::get<Is>(t)), 0) ...
+        };
+    }
+
+    // append the n values starting at first to column I checking only
+    // those which might not be in range.
+    template<std::size_t I, class T>
+    void append_column(const std::size_t & n, const T * first){
+        using F = field_type<I>;
+        std::vector<stored_type<I>> & c = column_vector<I>();
+        const std::size_t offset = c.size();
+        c.resize(offset + n);
+        stored_type<I> * const out = c.data() + offset;
+        if(soa_detail::includes<F, T>()){
+            for(std::size_t i = 0; i < n; ++i)
+                out[i] = static_cast<stored_type<I>>(base_value(first[i]));
+            return;
+        }
+        // check the range of each block with one branch free pass which
+        // the compiler can vectorize.  Only blocks with values out of range
+        // are converted element by element so that the error is reported
+        // for the first offending value.
+        for(std::size_t b = 0; b < n; b += batch_block_size){
+            const std::size_t m = std::min(batch_block_size, n - b);
+            if(soa_detail::in_range<F>(block_bounds(first + b, m)))
+                for(std::size_t i = b; i < b + m; ++i)
+                    out[i] = static_cast<stored_type<I>>(base_value(first[i]));
+            else
+                for(std::size_t i = b; i < b + m; ++i)
+                    out[i] = base_value(F(first[i]));
+        }
+    }
+
+    template<class ... T, std::size_t ... Is>
+    void append(
+        const std::size_t & n,
+        std::index_sequence<Is ...>,
+        const T * ... first
+    ){
+        (void)std::initializer_list<int>{(append_column<Is>(n, first), 0) ...};
+    }
+
+public:
+    // proxy for a row
+    template<class SOA>
+    class reference_type {
+        SOA * m_soa;
+        std::size_t m_i;
+    public:
+        reference_type(SOA * soa, const std::size_t & i) :
+            m_soa(soa),
+            m_i(i)
+        {}
+        template<std::size_t I>
+        field_type<I> get() const {
+            return m_soa->template get<I>(m_i);
+        }
+        // the value is checked only if its type might be out of the range
+        // of the field
+        template<std::size_t I, class T>
+        void set(const T & t) const {
+            m_soa->template set<I>(m_i, t);
+        }
+        operator value_type() const {
+            return static_cast<const SOA *>(m_soa)->row(m_i, sequence());
+        }
+        const reference_type & operator=(const value_type & t) const {
+            m_soa->assign(m_i, t, sequence());
+            return *this;
+        }
+        const reference_type & operator=(const reference_type & r) const {
+            return *this = static_cast<value_type>(r);
+        }
+    };
+    using reference = reference_type<safe_soa>;
+    using const_reference = reference_type<const safe_soa>;
+
+    std::size_t size() const {
+        return column_vector<0>().size();
+    }
+    bool empty() const {
+        return size() == 0;
+    }
+    void reserve(const std::size_t & n){
+        for_each_column([&](auto & c){ c.reserve(n); }, sequence());
+    }
+    void clear(){
+        for_each_column([](auto & c){ c.clear(); }, sequence());
+    }
+
+    // field I of row i
+    template<std::size_t I>
+    field_type<I> get(const std::size_t & i) const {
+        return soa_detail::make_field<field_type<I>>(column_vector<I>()[i]);
+    }
+    template<std::size_t I, class T>
+    void set(const std::size_t & i, const T & t){
+        column_vector<I>()[i] = base_value(field_type<I>(t));
+    }
+
+    reference operator[](const std::size_t & i){
+        return reference(this, i);
+    }
+    const_reference operator[](const std::size_t & i) const {
+        return const_reference(this, i);
+    }
+
+    // the values are already of the field types so no checking is required
+    void push_back(const Fields & ... fields){
+        push_back(value_type(fields ...));
+    }
+    void push_back(const value_type & t){
+        const std::size_t n = size();
+        try{
+            for_each_column([&](auto & c){ c.resize(n + 1); }, sequence());
+        }
+        catch(...){
+            for_each_column([&](auto & c){ c.resize(n); }, sequence());
+            throw;
+        }
+        assign(n, t, sequence());
+    }
+
+    // append n rows whose fields are taken from the given columns which
+    // may be of any integer or safe integer types.  Values which are out
+    // of the range of their fields are handled according to the exception
+    // policy of the field.  If an exception is thrown, the container is
+    // left unchanged.
+    template<class ... T>
+    void append(const std::size_t & n, const T * ... first){
+        static_assert(
+            sizeof...(T) == sizeof...(Fields),
+            "there must be one column for each field"
+        );
+        const std::size_t old_size = size();
+        try{
+            append(n, sequence(), first ...);
+        }
+        catch(...){
+            for_each_column([&](auto & c){ c.resize(old_size); }, sequence());
+            throw;
+        }
+    }
+
+    // the stored values of field I.  These may be passed to batch_evaluate
+    template<std::size_t I>
+    soa_column<stored_type<I>> column() const {
+        const std::vector<stored_type<I>> & c = column_vector<I>();
+        return soa_column<stored_type<I>>(c.data(), c.size());
+    }
+};
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_SAFE_SOA_HPP
@@ -0,0 +1,339 @@
+#ifndef BOOST_NUMERIC_SAFE_SORT_HPP
+#define BOOST_NUMERIC_SAFE_SORT_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// stable sort of a sequence whose key is a safe integer type such as
+// safe_signed_range<-1000, 1000>.  Since the type of the key fixes the
+// range [Min, Max] at compile time, the sort can be done without any
+// comparisons:
+// a) if the range is small, with a single counting sort pass.
+// b) otherwise with an LSD radix sort which takes exactly
+// ceil(bits(Max - Min) / 8) passes rather than one pass per byte of the
+// underlying type.
+// Keys are offset by Min so no special handling of negative values
+// is required.
+
+#include <cstddef>   // size_t
+#include <cstdint>   // uintmax_t
+#include <iterator>  // iterator_traits
+#include <memory>    // allocator, allocator_traits, addressof
+#include <type_traits>
+#include <utility>   // declval, move
+#include <vector>
+
+#include "range_key.hpp"
+#include "parallel.hpp"
+#include "utility.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+// default projection - the elements are themselves the keys
+struct sort_identity {
+    template<class T>
+    constexpr const T & operator()(const T & t) const {
+        return t;
+    }
+};
+
+namespace sort_detail {
+
+template<class KeyT>
+struct plan {
+    using traits = range_key_traits<KeyT>;
+
+    // number of bits required to hold Max - Min
+    constexpr static const unsigned int bits =
+        traits::span == 0 ? 0 : utility::ilog2(traits::span) + 1;
+
+    constexpr static const unsigned int radix_bits = 8;
+    constexpr static const std::size_t radix = std::size_t(1) << radix_bits;
+    constexpr static const unsigned int passes =
+        (bits + radix_bits - 1) / radix_bits;
+
+    // a counting sort takes one pass over the data but requires a
+    // histogram with one entry for each possible key.  Use it when the
+    // histogram is small or at least no larger than the data.
+    constexpr static const std::uintmax_t counting_limit = 1u << 12;
+    static bool use_counting(const std::size_t & n){
+        return traits::span < counting_limit || traits::span < n;
+    }
+};
+
+// storage for n elements of type V obtained from the allocator.  Elements
+// are constructed by the first pass which writes into the buffer.
+template<class V, class Allocator>
+class scratch_buffer {
+    using alloc_type =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<V>;
+    using alloc_traits = std::allocator_traits<alloc_type>;
+
+    alloc_type m_a;
+    const std::size_t m_n;
+    typename alloc_traits::pointer m_p;
+    bool m_constructed;
+
+public:
+    scratch_buffer(const Allocator & a, const std::size_t & n) :
+        m_a(a),
+        m_n(n),
+        m_p(alloc_traits::allocate(m_a, n)),
+        m_constructed(false)
+    {}
+    scratch_buffer(const scratch_buffer &) = delete;
+    scratch_buffer & operator=(const scratch_buffer &) = delete;
+    ~scratch_buffer(){
+        if(m_constructed)
+            for(std::size_t i = 0; i < m_n; ++i)
+                alloc_traits::destroy(m_a, data() + i);
+        alloc_traits::deallocate(m_a, m_p, m_n);
+    }
+    V * data(){
+        return std::addressof(*m_p);
+    }
+    bool constructed() const {
+        return m_constructed;
+    }
+    // every element is written exactly once by a pass
+    void set_constructed(){
+        m_constructed = true;
+    }
+    template<class T>
+    void construct(const std::size_t & i, T && t){
+        alloc_traits::construct(m_a, data() + i, std::forward<T>(t));
+    }
+};
+
+// one pass of a stable counting sort which moves the n elements of src
+// to dst ordered on digit(x) which is in [0, buckets). The elements are
+// divided into c chunks which are processed concurrently.  Returns false
+// without moving anything if all the elements have the same digit.
+template<class Src, class Store, class Digit, class SizeVector>
+bool counting_pass(
+    const std::size_t c,
+    const std::size_t n,
+    const std::size_t buckets,
+    Src src,
+    Store store,
+    Digit digit,
+    SizeVector & counts
+){
+    counts.assign(c * buckets, 0);
+    parallel_for_chunks(c, n,
+        [&](const std::size_t i, std::size_t first, const std::size_t last){
+            std::size_t * const h = counts.data() + i * buckets;
+            for(; first < last; ++first)
+                ++h[digit(src[first])];
+        }
+    );
+    // replace the counts with the starting position of each bucket in
+    // each chunk.  Elements from earlier chunks precede those from later
+    // chunks in the same bucket so the sort is stable.
+    std::size_t sum = 0;
+    for(std::size_t b = 0; b < buckets; ++b){
+        for(std::size_t i = 0; i < c; ++i){
+            std::size_t & x = counts[i * buckets + b];
+            if(x == n)
+                return false;
+            const std::size_t t = x;
+            x = sum;
+            sum += t;
+        }
+    }
+    parallel_for_chunks(c, n,
+        [&](const std::size_t i, std::size_t first, const std::size_t last){
+            std::size_t * const h = counts.data() + i * buckets;
+            for(; first < last; ++first)
+                store(h[digit(src[first])]++, src[first]);
+        }
+    );
+    return true;
+}
+
+template<class It, class Projection>
+using key_type_of = typename std::decay<
+    decltype(std::declval<Projection &>()(*std::declval<It &>()))
+>::type;
+
+// when the elements are the keys, equal elements are indistinguishable.
+// So the sequence can be rewritten from the histogram without moving
+// any elements.
+template<class RandomIt, class KeyT, class SizeVector>
+void count_keys(RandomIt first, const std::size_t & n, SizeVector & counts){
+    using traits = range_key_traits<KeyT>;
+    const std::size_t buckets = static_cast<std::size_t>(traits::span) + 1;
+    counts.assign(buckets, 0);
+    for(std::size_t i = 0; i < n; ++i)
+        ++counts[static_cast<std::size_t>(traits::offset(first[i]))];
+    for(std::size_t b = 0; b < buckets; ++b){
+        const KeyT k = traits::key(b);
+        for(std::size_t j = counts[b]; j > 0; --j)
+            *first++ = k;
+    }
+}
+
+template<class RandomIt, class Projection, class Allocator>
+void sort(
+    const std::size_t & c,
+    RandomIt first,
+    const std::size_t & n,
+    Projection proj,
+    const Allocator & a,
+    std::false_type
+){
+    using V = typename std::iterator_traits<RandomIt>::value_type;
+    using KeyT = key_type_of<RandomIt, Projection>;
+    using traits = range_key_traits<KeyT>;
+    using size_alloc = typename std::allocator_traits<Allocator>::
+        template rebind_alloc<std::size_t>;
+
+    std::vector<std::size_t, size_alloc> counts{size_alloc(a)};
+    scratch_buffer<V, Allocator> buffer(a, n);
+    V * const b = buffer.data();
+
+    // store functions for each direction of a pass
+    auto to_buffer = [&](const std::size_t & j, V & v){
+        if(buffer.constructed())
+            b[j] = std::move(v);
+        else
+            buffer.construct(j, std::move(v));
+    };
+    auto to_sequence = [&](const std::size_t & j, V & v){
+        first[j] = std::move(v);
+    };
+
+    if(plan<KeyT>::use_counting(n)){
+        const std::size_t buckets = static_cast<std::size_t>(traits::span) + 1;
+        auto digit = [&](const V & v){
+            return static_cast<std::size_t>(traits::offset(proj(v)));
+        };
+        if(counting_pass(c, n, buckets, first, to_buffer, digit, counts)){
+            buffer.set_constructed();
+            for(std::size_t i = 0; i < n; ++i)
+                first[i] = std::move(b[i]);
+        }
+        return;
+    }
+
+    // LSD radix sort.  Passes alternate between the sequence and the
+    // buffer. A pass in which all the elements have the same digit
+    // is skipped.
+    bool in_buffer = false;
+    for(unsigned int p = 0; p < plan<KeyT>::passes; ++p){
+        const unsigned int shift = p * plan<KeyT>::radix_bits;
+        auto digit = [&](const V & v){
+            return static_cast<std::size_t>(
+                (traits::offset(proj(v)) >> shift) & (plan<KeyT>::radix - 1)
+            );
+        };
+        if(in_buffer){
+            if(counting_pass(c, n, plan<KeyT>::radix, b, to_sequence, digit, counts))
+                in_buffer = false;
+        }
+        else{
+            if(counting_pass(c, n, plan<KeyT>::radix, first, to_buffer, digit, counts)){
+                buffer.set_constructed();
+                in_buffer = true;
+            }
+        }
+    }
+    if(in_buffer)
+        for(std::size_t i = 0; i < n; ++i)
+            first[i] = std::move(b[i]);
+}
+
+template<class RandomIt, class Projection, class Allocator>
+void sort(
+    const std::size_t & c,
+    RandomIt first,
+    const std::size_t & n,
+    Projection proj,
+    const Allocator & a,
+    std::true_type // elements are keys
+){
+    using KeyT = typename std::iterator_traits<RandomIt>::value_type;
+    using size_alloc = typename std::allocator_traits<Allocator>::
+        template rebind_alloc<std::size_t>;
+    if(c == 1 && plan<KeyT>::use_counting(n)){
+        std::vector<std::size_t, size_alloc> counts{size_alloc(a)};
+        count_keys<RandomIt, KeyT>(first, n, counts);
+        return;
+    }
+    sort(c, first, n, proj, a, std::false_type());
+}
+
+template<class RandomIt, class Projection, class Allocator>
+void sort(
+    const std::size_t & c,
+    RandomIt first,
+    RandomIt last,
+    Projection proj,
+    const Allocator & a
+){
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    if(n < 2)
+        return;
+    using V = typename std::iterator_traits<RandomIt>::value_type;
+    sort(
+        c, first, n, proj, a,
+        typename std::integral_constant<
+            bool,
+            std::is_same<Projection, sort_identity>::value
+            && std::is_same<key_type_of<RandomIt, Projection>, V>::value
+        >()
+    );
+}
+
+} // sort_detail
+
+// sort [first, last) so that proj(*i) is non decreasing.  Elements with
+// equal keys retain their relative order.  The type returned by proj must
+// be a safe integer type.  Temporary storage is obtained from a.
+template<
+    class RandomIt,
+    class Projection = sort_identity,
+    class Allocator = std::allocator<
+        typename std::iterator_traits<RandomIt>::value_type
+    >
+>
+void safe_sort(
+    RandomIt first,
+    RandomIt last,
+    Projection proj = Projection(),
+    const Allocator & a = Allocator()
+){
+    sort_detail::sort(1, first, last, proj, a);
+}
+
+// parallel variant.  The histograms and scatter of each pass are divided
+// among the threads permitted by the policy.  The result is identical to
+// the serial variant.
+template<
+    class RandomIt,
+    class Projection = sort_identity,
+    class Allocator = std::allocator<
+        typename std::iterator_traits<RandomIt>::value_type
+    >
+>
+void safe_sort(
+    const parallel_policy & pp,
+    RandomIt first,
+    RandomIt last,
+    Projection proj = Projection(),
+    const Allocator & a = Allocator()
+){
+    sort_detail::sort(
+        pp.chunk_count(static_cast<std::size_t>(last - first)),
+        first, last, proj, a
+    );
+}
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_SAFE_SORT_HPP
@@ -0,0 +1,474 @@
+#ifndef BOOST_NUMERIC_SAFE_SUM_TREE_HPP
+#define BOOST_NUMERIC_SAFE_SUM_TREE_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// trees of partial sums over a fixed number N of values of a safe type T.
+//
+// safe_fenwick<T, N> is a Fenwick (binary indexed) tree.  A node whose
+// index has k trailing zeros holds the sum of exactly 2^k values so its
+// range is [2^k * Min, 2^k * Max].  safe_segment_tree<T, N> is a segment
+// tree whose nodes at height h hold the sums of at most 2^h values.
+//
+// Rather than holding every node in a type wide enough for the sum of all
+// N values, the nodes of each level are held in their own array of the
+// narrowest integer which holds the range of that level.  For example the
+// nodes of safe_fenwick<safe_unsigned_range<0, 255>, 1024> near the leaves
+// are held in bytes and only the top levels need 32 bits.
+//
+// Since the range of every node is known, updates and queries are
+// calculated with modular arithmetic and need no checking.  Only the
+// values and indices passed in by the user are checked on conversion to
+// the value type T and the index types - and then only if they might not
+// be in range.  The sums are returned as a safe range type which holds
+// the sum of any number of values up to N.
+
+#include <array>
+#include <cstddef>   // size_t
+#include <cstdint>   // intmax_t, uintmax_t
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>   // index_sequence
+
+#include <boost/config.hpp> // BOOST_UNLIKELY
+
+#include "safe_common.hpp"
+#include "safe_integer_range.hpp"
+#include "safe_window.hpp" // sum_range, make_value
+#include "utility.hpp"
+#include "native.hpp"
+#include "exception.hpp"
+#include "exception_policies.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+namespace sum_tree_detail {
+
+// the range of a sum of between 0 and C values of type T
+template<class T, std::size_t C>
+struct partial_sum_range {
+    using wide_type = typename window_detail::sum_range<T, C>::wide_type;
+    constexpr static const wide_type min =
+        window_detail::sum_range<T, C>::min < 0
+        ? window_detail::sum_range<T, C>::min
+        : 0;
+    constexpr static const wide_type max =
+        window_detail::sum_range<T, C>::max > 0
+        ? window_detail::sum_range<T, C>::max
+        : 0;
+};
+
+// the safe range type of a Range with the policies of T
+template<class T, class Range, bool Negative = (Range::min < 0)>
+struct range_type {
+    using type = safe_signed_range<
+        static_cast<std::intmax_t>(Range::min),
+        static_cast<std::intmax_t>(Range::max),
+        typename get_promotion_policy<T>::type,
+        typename get_exception_policy<T>::type
+    >;
+};
+
+template<class T, class Range>
+struct range_type<T, Range, false> {
+    using type = safe_unsigned_range<
+        static_cast<std::uintmax_t>(Range::min),
+        static_cast<std::uintmax_t>(Range::max),
+        typename get_promotion_policy<T>::type,
+        typename get_exception_policy<T>::type
+    >;
+};
+
+// the narrowest integer which holds a Range
+template<class Range, bool Negative = (Range::min < 0)>
+struct stored {
+    using type = utility::signed_stored_type<
+        static_cast<std::intmax_t>(Range::min),
+        static_cast<std::intmax_t>(Range::max)
+    >;
+};
+
+template<class Range>
+struct stored<Range, false> {
+    using type = utility::unsigned_stored_type<
+        static_cast<std::uintmax_t>(Range::min),
+        static_cast<std::uintmax_t>(Range::max)
+    >;
+};
+
+constexpr std::size_t log2_floor(const std::size_t & n){
+    return n < 2 ? 0 : 1 + log2_floor(n >> 1);
+}
+constexpr std::size_t log2_ceil(const std::size_t & n){
+    return n < 2 ? 0 : 1 + log2_floor(n - 1);
+}
+
+// the value of the range of T nearest zero with which the elements are
+// initialized.
+template<class T>
+constexpr typename base_type<T>::type initial_value(){
+    using value_type = typename base_type<T>::type;
+    return
+        base_value(std::numeric_limits<T>::min()) > 0
+        ? base_value(std::numeric_limits<T>::min())
+        : base_value(std::numeric_limits<T>::max()) < 0
+        ? base_value(std::numeric_limits<T>::max())
+        : value_type(0);
+}
+
+// the shape of a Fenwick tree of N values.  The nodes 1 ... N whose
+// index j has K trailing zeros form level K.  Node j is element j >> (K + 1)
+// of its level and holds the sum of the 2^K values ending at value j - 1.
+template<std::size_t N>
+struct fenwick_shape {
+    constexpr static std::size_t levels(){
+        return log2_floor(N) + 1;
+    }
+    constexpr static std::size_t count(const std::size_t & k){
+        return ((N >> k) + 1) >> 1;
+    }
+    template<class T, std::size_t K>
+    using node_range = window_detail::sum_range<T, std::size_t(1) << K>;
+};
+
+// the shape of a segment tree of N values.  Level 0 holds the values and
+// node j of level H holds the sum of nodes 2j and 2j + 1 (if it exists) of
+// level H - 1.  The top level has a single node.
+template<std::size_t N>
+struct segment_shape {
+    constexpr static std::size_t levels(){
+        return log2_ceil(N) + 1;
+    }
+    constexpr static std::size_t count(const std::size_t & h){
+        return ((N - 1) >> h) + 1;
+    }
+    template<class T, std::size_t H>
+    using node_range = partial_sum_range<T, std::size_t(1) << H>;
+};
+
+// the arrays holding the nodes of each level of a tree
+template<class T, class Shape, class Levels>
+struct level_storage;
+
+template<class T, class Shape, std::size_t ... K>
+struct level_storage<T, Shape, std::index_sequence<K ...>> {
+    using type = std::tuple<
+        std::array<
+            typename stored<typename Shape::template node_range<T, K>>::type,
+            Shape::count(K)
+        > ...
+    >;
+};
+
+template<class T, class Shape>
+using levels = typename level_storage<
+    T,
+    Shape,
+    std::make_index_sequence<Shape::levels()>
+>::type;
+
+} // sum_tree_detail
+
+/////////////////////////////////////////////////////////////////
+// Fenwick tree
+
+template<class T, std::size_t N>
+class safe_fenwick {
+    static_assert(is_safe<T>::value, "the values must be safe integers");
+    static_assert(N > 0, "the tree must hold at least one value");
+
+    using shape = sum_tree_detail::fenwick_shape<N>;
+    constexpr static const std::size_t level_count = shape::levels();
+
+public:
+    using value_type = T;
+    // a safe range type which holds the sum of between 0 and N values
+    using sum_type = typename sum_tree_detail::range_type<
+        T,
+        sum_tree_detail::partial_sum_range<T, N>
+    >::type;
+    using index_type = safe_unsigned_range<
+        0, N - 1,
+        typename get_promotion_policy<T>::type,
+        typename get_exception_policy<T>::type
+    >;
+    // the number of values in a prefix
+    using count_type = safe_unsigned_range<
+        0, N,
+        typename get_promotion_policy<T>::type,
+        typename get_exception_policy<T>::type
+    >;
+
+private:
+    using sum_stored_type = typename base_type<sum_type>::type;
+
+    sum_tree_detail::levels<T, shape> m_levels;
+
+    template<std::size_t K>
+    using level_type = typename std::tuple_element<
+        K,
+        sum_tree_detail::levels<T, shape>
+    >::type;
+
+    template<std::size_t K>
+    level_type<K> & level(){
+        return std::get<K>(m_levels);
+    }
+    template<std::size_t K>
+    const level_type<K> & level() const {
+        return std::get<K>(m_levels);
+    }
+    template<std::size_t K>
+    using has_level = std::integral_constant<bool, (K < level_count)>;
+
+    // each level is filled with the sum of 2^K initial values
+    template<std::size_t K>
+    void initialize(std::true_type){
+        using node_type = typename level_type<K>::value_type;
+        level<K>().fill(static_cast<node_type>(
+            static_cast<std::uintmax_t>(sum_tree_detail::initial_value<T>()) << K
+        ));
+        initialize<K + 1>(has_level<K + 1>());
+    }
+    template<std::size_t K>
+    void initialize(std::false_type){}
+
+    // add d to the nodes j, j + lowbit(j), ... <= N.  The lowest bit set in
+    // successive nodes increases so each level holds at most one of them.
+    template<std::size_t K>
+    void add(std::size_t j, const std::uintmax_t & d, std::true_type){
+        if((j >> K) & 1){
+            if(j > N)
+                return;
+            using node_type = typename level_type<K>::value_type;
+            node_type & node = level<K>()[j >> (K + 1)];
+            node = static_cast<node_type>(static_cast<std::uintmax_t>(node) + d);
+            j += std::size_t(1) << K;
+        }
+        add<K + 1>(j, d, has_level<K + 1>());
+    }
+    template<std::size_t K>
+    void add(std::size_t, const std::uintmax_t &, std::false_type){}
+
+    // the sum of the nodes j, j - lowbit(j), ... > 0 - one for each bit
+    // set in j
+    template<std::size_t K>
+    std::uintmax_t prefix(const std::size_t & j, std::true_type) const {
+        return
+            (((j >> K) & 1)
+                ? static_cast<std::uintmax_t>(level<K>()[j >> (K + 1)])
+                : std::uintmax_t(0)
+            )
+            + prefix<K + 1>(j, has_level<K + 1>());
+    }
+    template<std::size_t K>
+    std::uintmax_t prefix(const std::size_t &, std::false_type) const {
+        return 0;
+    }
+    std::uintmax_t prefix(const std::size_t & j) const {
+        return prefix<0>(j, has_level<0>());
+    }
+
+public:
+    // every value is the value of T nearest zero
+    safe_fenwick(){
+        initialize<0>(has_level<0>());
+    }
+
+    constexpr static std::size_t size(){
+        return N;
+    }
+
+    // the value at index i
+    T operator[](const index_type & i) const {
+        const std::size_t j = base_value(i);
+        return window_detail::make_value<T>(prefix(j + 1) - prefix(j));
+    }
+
+    void set(const index_type & i, const T & t){
+        const std::size_t j = base_value(i);
+        const std::uintmax_t d =
+            static_cast<std::uintmax_t>(base_value(t))
+            - (prefix(j + 1) - prefix(j));
+        add<0>(j + 1, d, has_level<0>());
+    }
+
+    // the sum of the first n values
+    sum_type prefix_sum(const count_type & n) const {
+        return window_detail::make_value<sum_type>(
+            static_cast<sum_stored_type>(prefix(base_value(n)))
+        );
+    }
+
+    // the sum of the values [first, last).  first must not follow last.
+    sum_type sum(const count_type & first, const count_type & last) const {
+        if(BOOST_UNLIKELY(base_value(last) < base_value(first)))
+            dispatch<
+                typename get_exception_policy<T>::type,
+                safe_numerics_error::range_error
+            >(
+                "the first index follows the last"
+            );
+        return window_detail::make_value<sum_type>(
+            static_cast<sum_stored_type>(
+                prefix(base_value(last)) - prefix(base_value(first))
+            )
+        );
+    }
+};
+
+/////////////////////////////////////////////////////////////////
+// segment tree
+
+template<class T, std::size_t N>
+class safe_segment_tree {
+    static_assert(is_safe<T>::value, "the values must be safe integers");
+    static_assert(N > 0, "the tree must hold at least one value");
+
+    using shape = sum_tree_detail::segment_shape<N>;
+    constexpr static const std::size_t level_count = shape::levels();
+
+public:
+    using value_type = T;
+    // a safe range type which holds the sum of between 0 and N values
+    using sum_type = typename sum_tree_detail::range_type<
+        T,
+        sum_tree_detail::partial_sum_range<T, N>
+    >::type;
+    using index_type = safe_unsigned_range<
+        0, N - 1,
+        typename get_promotion_policy<T>::type,
+        typename get_exception_policy<T>::type
+    >;
+    using count_type = safe_unsigned_range<
+        0, N,
+        typename get_promotion_policy<T>::type,
+        typename get_exception_policy<T>::type
+    >;
+
+private:
+    using stored_type = typename base_type<T>::type;
+    using sum_stored_type = typename base_type<sum_type>::type;
+
+    sum_tree_detail::levels<T, shape> m_levels;
+
+    template<std::size_t H>
+    using level_type = typename std::tuple_element<
+        H,
+        sum_tree_detail::levels<T, shape>
+    >::type;
+
+    template<std::size_t H>
+    level_type<H> & level(){
+        return std::get<H>(m_levels);
+    }
+    template<std::size_t H>
+    const level_type<H> & level() const {
+        return std::get<H>(m_levels);
+    }
+    template<std::size_t H>
+    using has_level = std::integral_constant<bool, (H < level_count)>;
+
+    // node j of level H is the sum of its children
+    template<std::size_t H>
+    void update_node(const std::size_t & j){
+        using node_type = typename level_type<H>::value_type;
+        const level_type<H - 1> & children = level<H - 1>();
+        std::uintmax_t s = static_cast<std::uintmax_t>(children[2 * j]);
+        if(2 * j + 1 < children.size())
+            s += static_cast<std::uintmax_t>(children[2 * j + 1]);
+        level<H>()[j] = static_cast<node_type>(s);
+    }
+
+    template<std::size_t H>
+    void build(std::true_type){
+        for(std::size_t j = 0; j < level<H>().size(); ++j)
+            update_node<H>(j);
+        build<H + 1>(has_level<H + 1>());
+    }
+    template<std::size_t H>
+    void build(std::false_type){}
+
+    // update the ancestors of node j of level H - 1
+    template<std::size_t H>
+    void update(const std::size_t & j, std::true_type){
+        update_node<H>(j >> 1);
+        update<H + 1>(j >> 1, has_level<H + 1>());
+    }
+    template<std::size_t H>
+    void update(const std::size_t &, std::false_type){}
+
+    // the sum of the nodes [l, r) of level H
+    template<std::size_t H>
+    std::uintmax_t sum(std::size_t l, std::size_t r, std::true_type) const {
+        std::uintmax_t s = 0;
+        if(l >= r)
+            return s;
+        if(l & 1)
+            s += static_cast<std::uintmax_t>(level<H>()[l++]);
+        if(r & 1)
+            s += static_cast<std::uintmax_t>(level<H>()[--r]);
+        return s + sum<H + 1>(l >> 1, r >> 1, has_level<H + 1>());
+    }
+    template<std::size_t H>
+    std::uintmax_t sum(std::size_t, std::size_t, std::false_type) const {
+        return 0;
+    }
+
+public:
+    // every value is the value of T nearest zero
+    safe_segment_tree(){
+        level<0>().fill(sum_tree_detail::initial_value<T>());
+        build<1>(has_level<1>());
+    }
+
+    constexpr static std::size_t size(){
+        return N;
+    }
+
+    T operator[](const index_type & i) const {
+        return window_detail::make_value<T>(level<0>()[base_value(i)]);
+    }
+
+    void set(const index_type & i, const T & t){
+        const std::size_t j = base_value(i);
+        level<0>()[j] =
+            static_cast<typename level_type<0>::value_type>(base_value(t));
+        update<1>(j, has_level<1>());
+    }
+
+    sum_type prefix_sum(const count_type & n) const {
+        return window_detail::make_value<sum_type>(
+            static_cast<sum_stored_type>(
+                sum<0>(0, base_value(n), has_level<0>())
+            )
+        );
+    }
+
+    // the sum of the values [first, last).  first must not follow last.
+    sum_type sum(const count_type & first, const count_type & last) const {
+        if(BOOST_UNLIKELY(base_value(last) < base_value(first)))
+            dispatch<
+                typename get_exception_policy<T>::type,
+                safe_numerics_error::range_error
+            >(
+                "the first index follows the last"
+            );
+        return window_detail::make_value<sum_type>(
+            static_cast<sum_stored_type>(
+                sum<0>(base_value(first), base_value(last), has_level<0>())
+            )
+        );
+    }
+};
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_SAFE_SUM_TREE_HPP
@@ -0,0 +1,177 @@
+#ifndef BOOST_NUMERIC_SAFE_SWITCH_HPP
+#define BOOST_NUMERIC_SAFE_SWITCH_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// dispatch on the value of a safe integer type such as
+// safe_unsigned_range<0, 15>.  A switch statement on such a value includes
+// a range check and a default branch since the compiler doesn't know the
+// range of the value.  Here the range is known from the type so dispatch
+// is done through a table of function pointers with exactly one entry
+// for each value in [Min, Max] without any run time checking.
+//
+// safe_visit(v, h0, h1, ...) invokes the handler hi when v == Min + i. It
+// is a compile time error if there is not exactly one handler for each
+// value.
+//
+// safe_switch(v, f) invokes f(std::integral_constant<T, v>()) so that f can
+// use the value in a constant expression.  The result has the type
+// returned by f for the value Min.
+
+#include <cstddef>   // size_t
+#include <cstdint>   // uintmax_t
+#include <tuple>
+#include <type_traits>
+#include <utility>   // declval, index_sequence
+
+#include "range_key.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+namespace switch_detail {
+
+// handlers may accept the value as an integral_constant or take no
+// arguments at all
+template<class F, class C>
+constexpr auto invoke_case(F & f, const C & c, int) -> decltype(f(c)) {
+    return f(c);
+}
+template<class F, class C>
+constexpr auto invoke_case(F & f, const C &, long) -> decltype(f()) {
+    return f();
+}
+
+template<class KeyT, std::size_t I>
+using case_constant = std::integral_constant<
+    typename range_key_traits<KeyT>::stored_type,
+    static_cast<typename range_key_traits<KeyT>::stored_type>(
+        static_cast<std::uintmax_t>(range_key_traits<KeyT>::min) + I
+    )
+>;
+
+template<class KeyT, std::size_t I, class F>
+using case_result = decltype(
+    invoke_case(std::declval<F &>(), case_constant<KeyT, I>(), 0)
+);
+
+// tables are limited in size to keep the number of template
+// instantiations reasonable
+constexpr const std::uintmax_t max_table_size = 1u << 12;
+
+template<class KeyT>
+struct check_range {
+    static_assert(
+        range_key_traits<KeyT>::span < max_table_size,
+        "the range of the type is too large for a dispatch table"
+    );
+    constexpr static const std::size_t size =
+        static_cast<std::size_t>(range_key_traits<KeyT>::span) + 1;
+};
+
+/////////////////////////////////////////////////////////////////
+// safe_visit
+
+template<class R, class KeyT, class Handlers, class Sequence>
+struct visit_table;
+
+template<class R, class KeyT, class Handlers, std::size_t ... Is>
+struct visit_table<R, KeyT, Handlers, std::index_sequence<Is ...>> {
+    template<std::size_t I>
+    static R call(Handlers & h){
+        return static_cast<R>(
+            invoke_case(std::get<I>(h), case_constant<KeyT, I>(), 0)
+        );
+    }
+    using function_type = R (*)(Handlers &);
+    constexpr static const function_type table[] = {& call<Is> ...};
+};
+
+template<class R, class KeyT, class Handlers, std::size_t ... Is>
+constexpr const typename visit_table<
+    R, KeyT, Handlers, std::index_sequence<Is ...>
+>::function_type
+visit_table<R, KeyT, Handlers, std::index_sequence<Is ...>>::table[];
+
+template<class KeyT, class Handlers, class Sequence>
+struct visit_result;
+
+template<class KeyT, class ... Handlers, std::size_t ... Is>
+struct visit_result<KeyT, std::tuple<Handlers & ...>, std::index_sequence<Is ...>> {
+    using type = typename std::common_type<
+        case_result<KeyT, Is, Handlers> ...
+    >::type;
+};
+
+/////////////////////////////////////////////////////////////////
+// safe_switch
+
+template<class R, class KeyT, class F, class Sequence>
+struct switch_table;
+
+template<class R, class KeyT, class F, std::size_t ... Is>
+struct switch_table<R, KeyT, F, std::index_sequence<Is ...>> {
+    template<std::size_t I>
+    static R call(F & f){
+        return static_cast<R>(f(case_constant<KeyT, I>()));
+    }
+    using function_type = R (*)(F &);
+    constexpr static const function_type table[] = {& call<Is> ...};
+};
+
+template<class R, class KeyT, class F, std::size_t ... Is>
+constexpr const typename switch_table<
+    R, KeyT, F, std::index_sequence<Is ...>
+>::function_type
+switch_table<R, KeyT, F, std::index_sequence<Is ...>>::table[];
+
+// the result type is that returned for the value Min.  The results for
+// the other values are converted to this type.  Using common_type here
+// would exceed the template depth limit for larger ranges.
+template<class KeyT, class F>
+using switch_result = typename std::decay<
+    decltype(std::declval<F &>()(case_constant<KeyT, 0>()))
+>::type;
+
+} // switch_detail
+
+template<class KeyT, class ... Handlers>
+inline auto safe_visit(const KeyT & v, Handlers && ... handlers){
+    constexpr const std::size_t size = switch_detail::check_range<KeyT>::size;
+    static_assert(
+        sizeof...(Handlers) == size,
+        "there must be exactly one handler for each value in [Min, Max]"
+    );
+    using handlers_type = std::tuple<Handlers & ...>;
+    using sequence = std::make_index_sequence<size>;
+    using result_type = typename switch_detail::visit_result<
+        KeyT, handlers_type, sequence
+    >::type;
+    handlers_type h(handlers ...);
+    // note: the offset is in [0, Max - Min] by construction of the
+    // type so no check is required
+    return switch_detail::visit_table<
+        result_type, KeyT, handlers_type, sequence
+    >::table[range_key_traits<KeyT>::offset(v)](h);
+}
+
+template<class KeyT, class F>
+inline auto safe_switch(const KeyT & v, F && f){
+    using function_type = typename std::remove_reference<F>::type;
+    using sequence = std::make_index_sequence<
+        switch_detail::check_range<KeyT>::size
+    >;
+    using result_type = switch_detail::switch_result<KeyT, function_type>;
+    return switch_detail::switch_table<
+        result_type, KeyT, function_type, sequence
+    >::table[range_key_traits<KeyT>::offset(v)](f);
+}
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_SAFE_SWITCH_HPP
@@ -0,0 +1,208 @@
+#ifndef BOOST_NUMERIC_SAFE_TRANSFORM_HPP
+#define BOOST_NUMERIC_SAFE_TRANSFORM_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// parallel application of a function on safe integers to each element
+// of one or more sequences:
+//
+//     out[i] = f(in0[i], in1[i], ...)
+//
+// The elements are divided into chunks of parallel_policy::m_grain elements.
+// Threads claim chunks in increasing order as they become free so that
+// the load is balanced even when some threads run slower than others.
+//
+// When the evaluation of any element fails, the index of that element is
+// recorded. Threads then abandon any work beyond that index but finish
+// any work below it.  So the error reported is always that for the lowest
+// failing index regardless of the number of threads or their timing.
+
+#include <algorithm> // min
+#include <atomic>
+#include <cstddef>   // size_t
+#include <exception> // exception_ptr
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include "safe_integer.hpp"
+#include "exception.hpp"
+#include "exception_policies.hpp"
+#include "parallel.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+namespace transform_detail {
+
+// arguments which are built in integers are passed to f as safe integers
+// so that f is evaluated with checked arithmetic.  Failures must throw to
+// be detected.  They are reported through the policy of the transform.
+template<class T>
+constexpr typename std::enable_if<
+    std::is_integral<T>::value,
+    safe<T>
+>::type
+as_safe(const T & t){
+    return safe<T>(t);
+}
+template<class T>
+constexpr typename std::enable_if<
+    ! std::is_integral<T>::value,
+    const T &
+>::type
+as_safe(const T & t){
+    return t;
+}
+
+// the lowest index at which the evaluation failed and the error found
+// there.  An error in a safe integer operation is kept as its code and
+// message so that it can be reported through the policy of the
+// transform.  Any other exception is kept to be rethrown.
+class first_error {
+    std::mutex m_mutex;
+    std::atomic<std::size_t> m_index;
+    safe_numerics_error m_code;
+    std::string m_message;
+    std::exception_ptr m_exception;
+    // true if i is lower than any index recorded so far
+    bool lower(const std::size_t & i){
+        if(i >= m_index.load(std::memory_order_relaxed))
+            return false;
+        m_index.store(i, std::memory_order_relaxed);
+        return true;
+    }
+public:
+    explicit first_error(const std::size_t & n) :
+        m_index(n),
+        m_code(safe_numerics_error::success)
+    {}
+    std::size_t index() const {
+        return m_index.load(std::memory_order_relaxed);
+    }
+    void record(const std::size_t & i, const std::system_error & e){
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(lower(i)){
+            m_code = static_cast<safe_numerics_error>(e.code().value());
+            m_message = e.what();
+            m_exception = nullptr;
+        }
+    }
+    void record(const std::size_t & i, const std::exception_ptr & e){
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(lower(i))
+            m_exception = e;
+    }
+    safe_numerics_error code() const {
+        return m_code;
+    }
+    const std::string & message() const {
+        return m_message;
+    }
+    const std::exception_ptr & exception() const {
+        return m_exception;
+    }
+};
+
+// elements between checks of the cancellation flag within a chunk
+constexpr const std::size_t cancellation_interval = 1024;
+
+} // transform_detail
+
+// return the index of the first element for which f failed or n if none
+// did.  Errors in the safe integer operations are reported through the
+// exception policy E with the failing index included in the message. Any
+// other exception is rethrown.  If the policy ignores the error, elements
+// after the failing one may or may not have been written.  Note that f
+// must use safe types whose policy throws on error for a failure to be
+// detected.
+template<
+    class E = default_exception_policy,
+    class F,
+    class Out,
+    class ... In
+>
+std::size_t safe_transform(
+    const parallel_policy & pp,
+    F f,
+    const std::size_t & n,
+    Out out,
+    In ... inputs
+){
+    const std::size_t grain = pp.m_grain;
+    const std::size_t chunks = n / grain + (n % grain != 0);
+    const std::size_t threads = std::min<std::size_t>(pp.threads(), chunks);
+
+    std::atomic<std::size_t> next(0);
+    transform_detail::first_error error(n);
+
+    parallel_invoke(threads, [&](const std::size_t){
+        for(;;){
+            const std::size_t first =
+                next.fetch_add(grain, std::memory_order_relaxed);
+            // chunks are claimed in increasing order so if this one is
+            // beyond the lowest failure, so are all the remaining ones.
+            if(first >= n || first >= error.index())
+                return;
+            const std::size_t last = std::min(first + grain, n);
+            std::size_t i = first;
+            try{
+                for(; i < last; ++i){
+                    if((i - first) % transform_detail::cancellation_interval == 0
+                    && i >= error.index())
+                        break;
+                    out[i] = f(transform_detail::as_safe(inputs[i]) ...);
+                }
+            }
+            catch(const std::system_error & e){
+                if(e.code().category() == safe_numerics_error_category)
+                    error.record(i, e);
+                else
+                    error.record(i, std::current_exception());
+            }
+            catch(...){
+                error.record(i, std::current_exception());
+            }
+        }
+    });
+
+    const std::size_t index = error.index();
+    if(index == n)
+        return n;
+    if(error.exception())
+        std::rethrow_exception(error.exception());
+    const std::string msg =
+        "safe_transform: element " + std::to_string(index) + ": "
+        + error.message();
+    runtime_dispatch<E>(error.code(), msg.c_str());
+    return index;
+}
+
+// serial variant
+template<
+    class E = default_exception_policy,
+    class F,
+    class Out,
+    class ... In
+>
+std::size_t safe_transform(
+    F f,
+    const std::size_t & n,
+    Out out,
+    In ... inputs
+){
+    return safe_transform<E>(
+        parallel_policy(1, n == 0 ? 1 : n),
+        f, n, out, inputs ...
+    );
+}
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_SAFE_TRANSFORM_HPP
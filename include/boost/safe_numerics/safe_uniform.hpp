@@ -0,0 +1,306 @@
+#ifndef BOOST_NUMERIC_SAFE_UNIFORM_HPP
+#define BOOST_NUMERIC_SAFE_UNIFORM_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// uniformly distributed random values of a safe range type such as
+// safe_unsigned_range<1, 6>.  Using std::uniform_int_distribution and
+// then constructing the safe value is slow, the sequence differs between
+// implementations and the value is validated although it can't be out
+// of range.  Here
+//
+//     safe_uniform<safe_unsigned_range<1, 6>> die;
+//     std::mt19937 g;
+//     auto x = die(g);
+//
+// maps the output of the generator to [Min, Max] with Lemire's nearly
+// divisionless method:  a random word x is multiplied by the number of
+// values s and the high word of the product is the result.  The result
+// is biased only if the low word is less than 2^w mod s in which case x
+// is rejected.  The value is constructed without validation.
+//
+// counter_engine is a counter based generator - the nth value depends
+// only on the seed and n.  Since the values can be computed independently
+// safe_uniform<T>::generate(out, n, engine) fills an array of the values
+// of T with a loop which can be vectorized.
+
+#include <cstddef>   // size_t
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "safe_common.hpp"
+#include "range_key.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+/////////////////////////////////////////////////////////////////
+// counter based generator.  The output is that of SplitMix64 which is
+// not suitable for cryptography.
+
+class counter_engine {
+    std::uint64_t m_seed;
+    std::uint64_t m_counter;
+public:
+    using result_type = std::uint64_t;
+
+    constexpr static const std::uint64_t increment = 0x9e3779b97f4a7c15u;
+
+    constexpr static result_type min(){
+        return 0;
+    }
+    constexpr static result_type max(){
+        return std::numeric_limits<result_type>::max();
+    }
+    // the finalizer of SplitMix64
+    constexpr static result_type mix(std::uint64_t z){
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9u;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebu;
+        return z ^ (z >> 31);
+    }
+
+    constexpr explicit counter_engine(
+        const std::uint64_t & seed = 0,
+        const std::uint64_t & counter = 0
+    ) :
+        m_seed(seed),
+        m_counter(counter)
+    {}
+
+    // the value for any counter
+    constexpr result_type operator()(const std::uint64_t & counter) const {
+        return mix(m_seed + (counter + 1) * increment);
+    }
+    result_type operator()(){
+        return (*this)(m_counter++);
+    }
+    constexpr std::uint64_t seed() const {
+        return m_seed;
+    }
+    constexpr std::uint64_t counter() const {
+        return m_counter;
+    }
+    void discard(const std::uint64_t & n){
+        m_counter += n;
+    }
+};
+
+namespace uniform_detail {
+
+// the high and low words of the product of a and b
+inline std::uint64_t multiply(
+    const std::uint64_t & a,
+    const std::uint64_t & b,
+    std::uint64_t & low
+){
+    #if defined(__SIZEOF_INT128__)
+    const unsigned __int128 m = static_cast<unsigned __int128>(a) * b;
+    low = static_cast<std::uint64_t>(m);
+    return static_cast<std::uint64_t>(m >> 64);
+    #else
+    const std::uint64_t a0 = a & 0xffffffffu, a1 = a >> 32;
+    const std::uint64_t b0 = b & 0xffffffffu, b1 = b >> 32;
+    const std::uint64_t p00 = a0 * b0, p01 = a0 * b1;
+    const std::uint64_t p10 = a1 * b0, p11 = a1 * b1;
+    const std::uint64_t mid = (p00 >> 32) + (p01 & 0xffffffffu) + (p10 & 0xffffffffu);
+    low = (mid << 32) | (p00 & 0xffffffffu);
+    return p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    #endif
+}
+
+inline std::uint32_t multiply(
+    const std::uint32_t & a,
+    const std::uint32_t & b,
+    std::uint32_t & low
+){
+    const std::uint64_t m = static_cast<std::uint64_t>(a) * b;
+    low = static_cast<std::uint32_t>(m);
+    return static_cast<std::uint32_t>(m >> 32);
+}
+
+// a value in [0, s) from words of type W returned by next
+template<class W, class F>
+inline W lemire(const W & s, F next){
+    W low;
+    W r = multiply(next(), s, low);
+    if(low < s){
+        const W t = static_cast<W>(static_cast<W>(0u - s) % s);
+        while(low < t)
+            r = multiply(next(), s, low);
+    }
+    return r;
+}
+
+// words of 32 or 64 bits from a generator which returns either
+template<class URBG>
+struct words {
+    using result_type = typename URBG::result_type;
+    constexpr static const bool is_64 =
+        URBG::min() == 0
+        && static_cast<std::uint64_t>(URBG::max()) == 0xffffffffffffffffu;
+    constexpr static const bool is_32 =
+        URBG::min() == 0
+        && static_cast<std::uint64_t>(URBG::max()) == 0xffffffffu;
+    static_assert(
+        is_32 || is_64,
+        "the generator must return 32 or 64 random bits"
+    );
+    static std::uint32_t next32(URBG & g){
+        return static_cast<std::uint32_t>(g());
+    }
+    static std::uint64_t next64(URBG & g, std::true_type){
+        return static_cast<std::uint64_t>(g());
+    }
+    static std::uint64_t next64(URBG & g, std::false_type){
+        const std::uint64_t high = static_cast<std::uint32_t>(g());
+        return (high << 32) | static_cast<std::uint32_t>(g());
+    }
+    static std::uint64_t next64(URBG & g){
+        return next64(g, std::integral_constant<bool, is_64>());
+    }
+};
+
+} // uniform_detail
+
+template<class T>
+class safe_uniform {
+    using traits = range_key_traits<T>;
+    static_assert(
+        std::numeric_limits<std::uintmax_t>::digits == 64,
+        "safe_uniform presumes 64 bit integers"
+    );
+    // values are generated as offsets from the minimum in [0, span]
+    constexpr static const std::uintmax_t span = traits::span;
+    constexpr static const bool is_small = span < 0xffffffffu;
+
+    template<class URBG>
+    static std::uintmax_t offset(URBG & g){
+        using w = uniform_detail::words<URBG>;
+        if(span == 0xffffffffu)
+            return w::next32(g);
+        if(span == std::numeric_limits<std::uintmax_t>::max())
+            return w::next64(g);
+        if(is_small)
+            return uniform_detail::lemire(
+                static_cast<std::uint32_t>(span + 1),
+                [&g]{return w::next32(g);}
+            );
+        return uniform_detail::lemire(
+            static_cast<std::uint64_t>(span + 1),
+            [&g]{return w::next64(g);}
+        );
+    }
+
+public:
+    using result_type = T;
+    using stored_type = typename traits::stored_type;
+
+    constexpr static T min(){
+        return traits::key(0);
+    }
+    constexpr static T max(){
+        return traits::key(span);
+    }
+
+    template<class URBG>
+    T operator()(URBG & g) const {
+        return traits::key(offset(g));
+    }
+
+    // fill out[0, n) with the values for the next n counters of the
+    // engine and advance it.  Each value depends only on the seed and
+    // its counter so the results don't depend on how the array is divided
+    // among calls.  Note that the values are not those which would be
+    // returned by n invocations of operator().
+    static void generate(
+        stored_type * out,
+        const std::size_t & n,
+        counter_engine & g
+    ){
+        const std::uint64_t first = g.counter();
+        g.discard(n);
+        generate(out, n, g, first, std::integral_constant<bool, is_small>());
+    }
+
+private:
+    // the value for a counter whose first candidate was rejected is drawn
+    // from a stream of its own
+    static T redraw(const counter_engine & g, const std::uint64_t & counter){
+        counter_engine stream(counter_engine::mix(g.seed() ^ counter), 0);
+        return traits::key(offset(stream));
+    }
+
+    static void generate(
+        stored_type * out,
+        const std::size_t & n,
+        const counter_engine & g,
+        const std::uint64_t & first,
+        std::false_type
+    ){
+        const std::uintmax_t min_value = static_cast<std::uintmax_t>(traits::min);
+        if(span == std::numeric_limits<std::uintmax_t>::max()){
+            for(std::size_t i = 0; i < n; ++i)
+                out[i] = static_cast<stored_type>(min_value + g(first + i));
+            return;
+        }
+        const std::uint64_t s = static_cast<std::uint64_t>(span + 1);
+        const std::uint64_t t = (0u - s) % s;
+        for(std::size_t i = 0; i < n; ++i){
+            std::uint64_t low;
+            const std::uint64_t r = uniform_detail::multiply(g(first + i), s, low);
+            out[i] = low < t
+                ? base_value(redraw(g, first + i))
+                : static_cast<stored_type>(min_value + r);
+        }
+    }
+
+    static void generate(
+        stored_type * out,
+        const std::size_t & n,
+        const counter_engine & g,
+        const std::uint64_t & first,
+        std::true_type
+    ){
+        // a branch free loop over the candidates which notes the least
+        // low word.  Only if it's below the threshold is there a second
+        // pass to replace the candidates which must be rejected.
+        const std::uint32_t s = static_cast<std::uint32_t>(span + 1);
+        const std::uint32_t t = static_cast<std::uint32_t>(0u - s) % s;
+        const std::uintmax_t min_value = static_cast<std::uintmax_t>(traits::min);
+        std::uint32_t least = std::numeric_limits<std::uint32_t>::max();
+        for(std::size_t i = 0; i < n; ++i){
+            std::uint32_t low;
+            const std::uint32_t r = uniform_detail::multiply(
+                static_cast<std::uint32_t>(g(first + i)), s, low
+            );
+            out[i] = static_cast<stored_type>(min_value + r);
+            least = low < least ? low : least;
+        }
+        if(least >= t)
+            return;
+        for(std::size_t i = 0; i < n; ++i){
+            std::uint32_t low;
+            uniform_detail::multiply(
+                static_cast<std::uint32_t>(g(first + i)), s, low
+            );
+            if(low < t)
+                out[i] = base_value(redraw(g, first + i));
+        }
+    }
+};
+
+template<class T>
+constexpr const std::uintmax_t safe_uniform<T>::span;
+
+template<class T>
+constexpr const bool safe_uniform<T>::is_small;
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_SAFE_UNIFORM_HPP
@@ -0,0 +1,263 @@
+#ifndef BOOST_NUMERIC_SAFE_VERIFY_HPP
+#define BOOST_NUMERIC_SAFE_VERIFY_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// exhaustive verification of a function of safe integer arguments with
+// small ranges such as safe<std::uint8_t> or safe_unsigned_range<0, 1000>.
+//
+//     safe_verify<K0, K1, ...>(f)
+//
+// invokes f(k0, k1, ...) for every combination of values of the types
+// K0, K1, ... and reports those for which f fails.  For the 8 and 16 bit
+// types common in controller code, this proves that a function never
+// raises an error rather than just testing it at a few points.
+//
+// A failure is detected either by an exception thrown from f or by an
+// error recorded by sticky_exception while f runs.  So f must use safe
+// types whose policy is a throwing or sticky one. Errors ignored by the
+// policy cannot be detected.
+
+#include <chrono>
+#include <cstddef>   // size_t
+#include <cstdint>   // uintmax_t
+#include <initializer_list>
+#include <limits>
+#include <system_error>
+#include <tuple>
+#include <utility>   // index_sequence
+#include <vector>
+
+#include "exception.hpp"
+#include "exception_policies.hpp"
+#include "range_key.hpp"
+#include "parallel.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+// the values of the arguments for which f failed and the error detected
+template<class ... KeyT>
+struct verify_failure {
+    std::tuple<typename range_key_traits<KeyT>::stored_type ...> m_arguments;
+    safe_numerics_error m_error;
+};
+
+template<class ... KeyT>
+struct verify_report {
+    // number of combinations of argument values
+    std::uintmax_t m_domain_size;
+    // number of combinations evaluated
+    std::uintmax_t m_cases;
+    // number of combinations for which f failed
+    std::uintmax_t m_failures;
+    // the first failures in the order in which the arguments are
+    // enumerated.  The last argument varies fastest.
+    std::vector<verify_failure<KeyT ...>> m_failing;
+    double m_seconds;
+
+    bool passed() const {
+        return m_cases == m_domain_size && m_failures == 0;
+    }
+    // the fraction of the domain which was evaluated
+    double coverage() const {
+        return m_domain_size == 0
+            ? 1.0
+            : static_cast<double>(m_cases) / static_cast<double>(m_domain_size);
+    }
+    // combinations evaluated per second
+    double throughput() const {
+        return m_seconds > 0 ? m_cases / m_seconds : 0;
+    }
+};
+
+namespace verify_detail {
+
+// the product of the number of values of each argument or 0 if it
+// cannot be represented
+constexpr std::uintmax_t domain_size(std::initializer_list<std::uintmax_t> spans){
+    std::uintmax_t n = 1;
+    for(const std::uintmax_t s : spans){
+        if(s == std::numeric_limits<std::uintmax_t>::max())
+            return 0;
+        if(n > std::numeric_limits<std::uintmax_t>::max() / (s + 1))
+            return 0;
+        n *= s + 1;
+    }
+    return n;
+}
+
+// failures recorded by one chunk of the domain
+template<class ... KeyT>
+struct chunk_result {
+    std::uintmax_t m_cases;
+    std::uintmax_t m_failures;
+    std::vector<verify_failure<KeyT ...>> m_failing;
+};
+
+template<class ... KeyT>
+class verifier {
+    constexpr static const std::size_t arity = sizeof...(KeyT);
+    using digits_type = std::uintmax_t[arity];
+
+    // invoke f on the arguments with the given offsets and return the
+    // error detected if any
+    template<class F, std::size_t ... Is>
+    static safe_numerics_error invoke(
+        F & f,
+        const digits_type & d,
+        std::index_sequence<Is ...>
+    ){
+        sticky_exception::clear();
+        try{
+            f(range_key_traits<KeyT>::key(d[Is]) ...);
+        }
+        catch(const std::system_error & e){
+            if(e.code().category() != safe_numerics_error_category)
+                throw;
+            return static_cast<safe_numerics_error>(e.code().value());
+        }
+        return sticky_exception::error();
+    }
+
+    template<std::size_t ... Is>
+    static verify_failure<KeyT ...> make_failure(
+        const digits_type & d,
+        const safe_numerics_error & e,
+        std::index_sequence<Is ...>
+    ){
+        return verify_failure<KeyT ...>{
+            std::make_tuple(base_value(range_key_traits<KeyT>::key(d[Is])) ...),
+            e
+        };
+    }
+
+public:
+    constexpr static const std::uintmax_t radix[] = {
+        range_key_traits<KeyT>::span + 1 ...
+    };
+
+    // evaluate f for the combinations [first, last) of the domain
+    template<class F>
+    static void run(
+        F & f,
+        std::uintmax_t first,
+        const std::uintmax_t last,
+        const std::size_t & max_recorded,
+        chunk_result<KeyT ...> & r
+    ){
+        std::uintmax_t count = last - first;
+        // the offsets of the arguments of combination first
+        digits_type d;
+        for(std::size_t k = arity; k-- > 0;){
+            d[k] = first % radix[k];
+            first /= radix[k];
+        }
+        const std::uintmax_t inner = radix[arity - 1];
+        while(count > 0){
+            // the innermost argument is varied in a tight loop.  The
+            // others only change when it wraps around.
+            for(; d[arity - 1] < inner && count > 0; ++d[arity - 1], --count){
+                const safe_numerics_error e =
+                    invoke(f, d, std::make_index_sequence<arity>());
+                ++r.m_cases;
+                if(e != safe_numerics_error::success){
+                    ++r.m_failures;
+                    if(r.m_failing.size() < max_recorded)
+                        r.m_failing.push_back(
+                            make_failure(d, e, std::make_index_sequence<arity>())
+                        );
+                }
+            }
+            // carry into the outer arguments
+            d[arity - 1] = 0;
+            for(std::size_t k = arity - 1; k-- > 0;){
+                if(++d[k] < radix[k])
+                    break;
+                d[k] = 0;
+            }
+        }
+    }
+};
+
+template<class ... KeyT>
+constexpr const std::uintmax_t verifier<KeyT ...>::radix[];
+
+} // verify_detail
+
+// evaluate f on every combination of values of the argument types KeyT
+// using the threads permitted by the policy.  At most max_recorded
+// failures are recorded in the report but all are counted.  Exceptions
+// other than those thrown by safe integer operations are propagated.
+template<class ... KeyT, class F>
+verify_report<KeyT ...> safe_verify(
+    const parallel_policy & pp,
+    F f,
+    const std::size_t & max_recorded = 1000
+){
+    static_assert(
+        sizeof...(KeyT) > 0,
+        "at least one argument type must be specified"
+    );
+    constexpr const std::uintmax_t domain =
+        verify_detail::domain_size({range_key_traits<KeyT>::span ...});
+    static_assert(
+        domain != 0
+        && domain <= std::numeric_limits<std::size_t>::max(),
+        "the domain is too large to enumerate"
+    );
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::size_t c = pp.chunk_count(static_cast<std::size_t>(domain));
+    std::vector<verify_detail::chunk_result<KeyT ...>> results(c);
+    parallel_for_chunks(c, static_cast<std::size_t>(domain),
+        [&](const std::size_t i, const std::size_t first, const std::size_t last){
+            // each thread gets its own copy of the function object
+            F g(f);
+            results[i].m_cases = 0;
+            results[i].m_failures = 0;
+            verify_detail::verifier<KeyT ...>::run(
+                g, first, last, max_recorded, results[i]
+            );
+        }
+    );
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    verify_report<KeyT ...> report{domain, 0, 0, {}, elapsed.count()};
+    // chunks are contiguous so concatenating them retains the order
+    for(const auto & r : results){
+        report.m_cases += r.m_cases;
+        report.m_failures += r.m_failures;
+        for(const auto & failure : r.m_failing){
+            if(report.m_failing.size() == max_recorded)
+                break;
+            report.m_failing.push_back(failure);
+        }
+    }
+    return report;
+}
+
+// serial variant - the whole domain is one chunk
+template<class ... KeyT, class F>
+verify_report<KeyT ...> safe_verify(
+    F f,
+    const std::size_t & max_recorded = 1000
+){
+    constexpr const std::uintmax_t domain =
+        verify_detail::domain_size({range_key_traits<KeyT>::span ...});
+    return safe_verify<KeyT ...>(
+        parallel_policy(1, static_cast<std::size_t>(domain)),
+        f,
+        max_recorded
+    );
+}
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_SAFE_VERIFY_HPP
@@ -0,0 +1,444 @@
+#ifndef BOOST_NUMERIC_SAFE_VIEW_HPP
+#define BOOST_NUMERIC_SAFE_VIEW_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// a lazy view of a range of integers as values of a safe type S
+//
+//     for(const S & s : raw | views::safe_cast<S>)
+//         ...
+//
+// Integers held in contiguous memory, such as those of an array or a
+// std::vector, are validated in place as the view arrives at each one.
+// The single comparison of safe_compare::in_range is then part of the
+// loop which uses the values and costs less than a separate pass over
+// them.  The values of any other range are read into a buffer in chunks.
+// The bounds of each chunk are calculated with a loop which the compiler
+// can vectorize and compared with the range of S.  Only if the chunk
+// contains a value outside that range are its elements checked one by
+// one.  Either way the values are yielded without further validation.
+//
+// An invalid value is reported through the exception policy of S, with
+// its position in the message, when the view arrives at it.  So all the
+// values which precede it have been yielded.  If the policy doesn't throw
+// the invalid value is skipped so that every value yielded is a valid S.
+//
+// The view is single pass.  Its iterators refer to the view, so it must
+// outlive them and begin() may be called only once.  A range which is an
+// rvalue, such as another view, is moved into the view so that
+//
+//     raw | std::views::transform(f) | views::safe_cast<S>
+//
+// may be used as well.
+
+#include <cstddef>  // size_t, ptrdiff_t
+#include <iterator> // begin, end, input_iterator_tag
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>  // declval, pair
+
+#include <boost/config.hpp> // BOOST_UNLIKELY
+
+#include "safe_common.hpp"
+#include "safe_compare.hpp"
+#include "exception.hpp"
+#include "exception_policies.hpp"
+#include "batch.hpp" // block_bounds
+
+namespace boost {
+namespace safe_numerics {
+
+// the number of values buffered by a view
+constexpr const std::size_t view_chunk_size = 64;
+
+namespace view_detail {
+
+template<class ... T>
+struct make_void {
+    using type = void;
+};
+
+// the iterators of a range.  Those of a range with contiguous storage,
+// which has data() and size(), are pointers.
+template<class R, class = void>
+struct range_iterators {
+    using type = decltype(std::begin(std::declval<R &>()));
+    static type first(R & r){
+        return std::begin(r);
+    }
+    static type last(R & r){
+        return std::end(r);
+    }
+};
+template<class R>
+struct range_iterators<
+    R,
+    typename make_void<
+        decltype(std::declval<R &>().data() + std::declval<R &>().size())
+    >::type
+> {
+    using type = decltype(std::declval<R &>().data());
+    static type first(R & r){
+        return r.data();
+    }
+    static type last(R & r){
+        return r.data() + r.size();
+    }
+};
+
+// true if I points to integers which can be validated in place
+template<class I>
+using is_contiguous = std::integral_constant<
+    bool,
+    std::is_pointer<I>::value
+    && std::is_integral<typename std::remove_pointer<I>::type>::value
+>;
+
+// the validation of values of type T as values of S
+template<class S, class T>
+struct validation {
+    using stored_type = typename base_type<S>::type;
+    using exception_policy = typename get_exception_policy<S>::type;
+
+    static_assert(
+        std::numeric_limits<T>::is_integer,
+        "safe_cast views a range of integers"
+    );
+
+    constexpr static stored_type min(){
+        return base_value(std::numeric_limits<S>::min());
+    }
+    constexpr static stored_type max(){
+        return base_value(std::numeric_limits<S>::max());
+    }
+    // false if every value of T is a value of S
+    constexpr static bool check_required(){
+        return safe_compare::less_than(std::numeric_limits<T>::min(), min())
+            || safe_compare::greater_than(std::numeric_limits<T>::max(), max());
+    }
+    constexpr static bool valid(const T & t){
+        return ! check_required() || safe_compare::in_range(t, min(), max());
+    }
+    static S yield(const T & t){
+        return S(static_cast<stored_type>(t), typename S::skip_validation());
+    }
+    // report the invalid value t at the given position in the range
+    static void report(const std::size_t & position, const T & t){
+        const std::string msg =
+            "safe_cast: element " + std::to_string(position)
+            + " is out of range";
+        if(safe_compare::greater_than(t, max()))
+            dispatch<
+                exception_policy,
+                safe_numerics_error::positive_overflow_error
+            >(msg.c_str());
+        else
+            dispatch<
+                exception_policy,
+                safe_numerics_error::negative_overflow_error
+            >(msg.c_str());
+    }
+};
+
+} // view_detail
+
+// a view of a range which is read into a buffer in chunks
+template<
+    class S,
+    class I,
+    bool Contiguous = view_detail::is_contiguous<I>::value
+>
+class safe_cast_view {
+    using input_type = typename base_type<
+        typename std::iterator_traits<I>::value_type
+    >::type;
+    using validation = view_detail::validation<S, input_type>;
+
+    I m_first;
+    I m_last;
+    input_type m_buffer[view_chunk_size];
+    std::size_t m_size;     // number of values in the buffer
+    std::size_t m_invalid;  // the first invalid value not yet reported
+    std::size_t m_position; // position in the range of m_buffer[0]
+
+    std::size_t find_invalid(std::size_t i) const {
+        for(; i < m_size; ++i)
+            if(! validation::valid(m_buffer[i]))
+                break;
+        return i;
+    }
+    void validate(std::true_type){
+        const auto bounds = block_bounds(m_buffer, m_size);
+        m_invalid =
+            validation::valid(bounds.first) && validation::valid(bounds.second)
+            ? m_size
+            : find_invalid(0);
+    }
+    void validate(std::false_type){
+        m_invalid = m_size;
+    }
+    void fill(){
+        m_position += m_size;
+        // locals so that the compiler needn't store them on each iteration
+        I first = m_first;
+        std::size_t n = 0;
+        for(; n < view_chunk_size && first != m_last; ++first)
+            m_buffer[n++] = base_value(*first);
+        m_first = first;
+        m_size = n;
+        if(m_size > 0)
+            validate(
+                std::integral_constant<bool, validation::check_required()>()
+            );
+    }
+    // called when an iterator arrives at the end of the buffer or at an
+    // invalid value.  Return the values from the current one up to the
+    // limit which may be yielded without further ado.  At the end of the
+    // range both are null.
+    using span = std::pair<const input_type *, const input_type *>;
+    span next(const input_type * cur){
+        std::size_t i = cur - m_buffer;
+        for(;;){
+            if(i == m_size){
+                fill();
+                if(m_size == 0)
+                    return span(nullptr, nullptr);
+                i = 0;
+            }
+            if(i != m_invalid)
+                return span(m_buffer + i, m_buffer + m_invalid);
+            // an invalid value is never yielded
+            validation::report(m_position + i, m_buffer[i]);
+            m_invalid = find_invalid(i + 1);
+            ++i;
+        }
+    }
+
+public:
+    class iterator {
+        friend safe_cast_view;
+        safe_cast_view * m_view;
+        const input_type * m_cur;
+        const input_type * m_limit;
+        explicit iterator(safe_cast_view * view) :
+            m_view(view)
+        {
+            set(m_view->next(m_view->m_buffer));
+        }
+        void set(const span & s){
+            m_cur = s.first;
+            m_limit = s.second;
+        }
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = S;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = S;
+
+        iterator() :
+            m_view(nullptr),
+            m_cur(nullptr),
+            m_limit(nullptr)
+        {}
+        S operator*() const {
+            return validation::yield(*m_cur);
+        }
+        iterator & operator++(){
+            if(++m_cur == m_limit)
+                set(m_view->next(m_cur));
+            return *this;
+        }
+        void operator++(int){
+            ++*this;
+        }
+        // an iterator is equal to the end when the view is exhausted
+        friend bool operator==(const iterator & lhs, const iterator & rhs){
+            return lhs.m_cur == rhs.m_cur;
+        }
+        friend bool operator!=(const iterator & lhs, const iterator & rhs){
+            return ! (lhs == rhs);
+        }
+    };
+
+    safe_cast_view(I first, I last) :
+        m_first(first),
+        m_last(last),
+        m_size(0),
+        m_invalid(0),
+        m_position(0)
+    {}
+    iterator begin(){
+        return iterator(this);
+    }
+    iterator end(){
+        return iterator();
+    }
+
+protected:
+    // the bounds are set by the derived class when begin() is called
+    safe_cast_view() :
+        m_first(),
+        m_last(),
+        m_size(0),
+        m_invalid(0),
+        m_position(0)
+    {}
+    void set_range(I first, I last){
+        m_first = first;
+        m_last = last;
+    }
+};
+
+// a view of integers in contiguous memory which are validated in place
+template<class S, class I>
+class safe_cast_view<S, I, true> {
+    using input_type = typename std::remove_cv<
+        typename std::remove_pointer<I>::type
+    >::type;
+    using validation = view_detail::validation<S, input_type>;
+
+    const input_type * m_begin;
+    const input_type * m_last;
+
+    // report any invalid values from p on and return the first valid one
+    const input_type * skip_invalid(const input_type * p) const {
+        for(; p != m_last && ! validation::valid(*p); ++p)
+            validation::report(static_cast<std::size_t>(p - m_begin), *p);
+        return p;
+    }
+
+public:
+    class iterator {
+        friend safe_cast_view;
+        const safe_cast_view * m_view;
+        const input_type * m_cur;
+        input_type m_value; // *m_cur once it has been validated
+        iterator(const safe_cast_view * view, const input_type * cur) :
+            m_view(view),
+            m_cur(cur),
+            m_value(cur == view->m_last ? input_type() : *cur)
+        {}
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = S;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = S;
+
+        iterator() :
+            m_view(nullptr),
+            m_cur(nullptr),
+            m_value()
+        {}
+        S operator*() const {
+            return validation::yield(m_value);
+        }
+        iterator & operator++(){
+            if(++m_cur == m_view->m_last)
+                return *this;
+            m_value = *m_cur;
+            // only the validation is unlikely to fail.  The end of the
+            // range is not.
+            if(BOOST_UNLIKELY(! validation::valid(m_value))){
+                m_cur = m_view->skip_invalid(m_cur);
+                if(m_cur != m_view->m_last)
+                    m_value = *m_cur;
+            }
+            return *this;
+        }
+        void operator++(int){
+            ++*this;
+        }
+        friend bool operator==(const iterator & lhs, const iterator & rhs){
+            return lhs.m_cur == rhs.m_cur;
+        }
+        friend bool operator!=(const iterator & lhs, const iterator & rhs){
+            return ! (lhs == rhs);
+        }
+    };
+
+    safe_cast_view(I first, I last) :
+        m_begin(first),
+        m_last(last)
+    {}
+    iterator begin(){
+        return iterator(this, skip_invalid(m_begin));
+    }
+    iterator end(){
+        return iterator(this, m_last);
+    }
+
+protected:
+    safe_cast_view() :
+        m_begin(nullptr),
+        m_last(nullptr)
+    {}
+    void set_range(I first, I last){
+        m_begin = first;
+        m_last = last;
+    }
+};
+
+// a view of a range which it owns.  The iterators of the range are
+// obtained only when the view is used as they may refer to the range,
+// which moves with the view until then.
+template<class S, class R>
+class safe_cast_owning_view :
+    public safe_cast_view<S, typename view_detail::range_iterators<R>::type>
+{
+    using iterators = view_detail::range_iterators<R>;
+    using base = safe_cast_view<S, typename iterators::type>;
+    R m_range;
+public:
+    explicit safe_cast_owning_view(R && r) :
+        m_range(std::move(r))
+    {}
+    typename base::iterator begin(){
+        base::set_range(iterators::first(m_range), iterators::last(m_range));
+        return base::begin();
+    }
+};
+
+namespace views {
+
+template<class S>
+struct safe_cast_adaptor {
+    static_assert(is_safe<S>::value, "safe_cast views a range as a safe type");
+};
+
+template<class S>
+constexpr const safe_cast_adaptor<S> safe_cast{};
+
+// the view refers to a range which is an lvalue
+template<class R, class S>
+safe_cast_view<S, typename view_detail::range_iterators<R>::type>
+operator|(R & r, const safe_cast_adaptor<S> &){
+    using iterators = view_detail::range_iterators<R>;
+    return safe_cast_view<S, typename iterators::type>(
+        iterators::first(r),
+        iterators::last(r)
+    );
+}
+
+// and owns one which is an rvalue
+template<
+    class R,
+    class S,
+    typename std::enable_if<! std::is_lvalue_reference<R>::value, int>::type = 0
+>
+safe_cast_owning_view<S, R>
+operator|(R && r, const safe_cast_adaptor<S> &){
+    return safe_cast_owning_view<S, R>(std::move(r));
+}
+
+} // views
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_SAFE_VIEW_HPP
@@ -0,0 +1,374 @@
+#ifndef BOOST_NUMERIC_SAFE_WINDOW_HPP
+#define BOOST_NUMERIC_SAFE_WINDOW_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// aggregates over the last W values of a stream of integers.
+//
+// safe_window_sum<T, W> maintains the sum of the last W values.  The sum
+// of W values in [Min, Max] is in [W * Min, W * Max].  This range is
+// calculated at compile time and the sum is returned as a safe range type
+// with exactly those bounds.  The running sum is held in an integer just
+// wide enough for this range and updated without any checking.  Any check
+// required is made when the sum is converted to the type of the user's
+// result.
+//
+// safe_window_min<T, W> and safe_window_max<T, W> maintain the minimum and
+// maximum of the last W values using a monotonic queue.  Each value pushed
+// is compared with those in the queue at most once, so the cost per value
+// is constant on average.
+
+#include <algorithm> // min
+#include <array>
+#include <cassert>
+#include <cstddef>   // size_t
+#include <cstdint>   // intmax_t, uintmax_t
+#include <functional> // less, greater
+#include <limits>
+#include <type_traits>
+
+#include "safe_common.hpp"
+#include "safe_integer_range.hpp"
+#include "checked_result.hpp"
+#include "checked_result_operations.hpp"
+#include "interval.hpp"
+#include "native.hpp"
+#include "exception_policies.hpp"
+
+namespace boost {
+namespace safe_numerics {
+
+namespace window_detail {
+
+template<class T, class Default>
+using policy_or = typename std::conditional<
+    std::is_void<T>::value,
+    Default,
+    T
+>::type;
+
+// build a value which is known to be in range
+template<class T, class V>
+constexpr typename std::enable_if<! is_safe<T>::value, T>::type
+make_value(const V & v){
+    return static_cast<T>(v);
+}
+template<class T, class V>
+constexpr typename std::enable_if<is_safe<T>::value, T>::type
+make_value(const V & v){
+    return T(
+        static_cast<typename base_type<T>::type>(v),
+        typename T::skip_validation()
+    );
+}
+
+// the range of the sum of W values of type T
+template<class T, std::size_t W>
+struct sum_range {
+    using value_type = typename base_type<T>::type;
+    static_assert(
+        std::is_integral<value_type>::value,
+        "window aggregates are only implemented for integers"
+    );
+    static_assert(W > 0, "the window must hold at least one value");
+
+    // calculate with the widest integer of the same signedness
+    using wide_type = typename std::conditional<
+        std::is_signed<value_type>::value,
+        std::intmax_t,
+        std::uintmax_t
+    >::type;
+    using r_type = checked_result<wide_type>;
+
+    constexpr static interval<r_type> get(){
+        return interval<r_type>(
+            r_type(static_cast<wide_type>(
+                base_value(std::numeric_limits<T>::min())
+            )),
+            r_type(static_cast<wide_type>(
+                base_value(std::numeric_limits<T>::max())
+            ))
+        ) * interval<r_type>(
+            r_type(static_cast<wide_type>(W)),
+            r_type(static_cast<wide_type>(W))
+        );
+    }
+    static_assert(
+        ! get().l.exception() && ! get().u.exception(),
+        "the sum of the window cannot be represented"
+    );
+    constexpr static const wide_type min = static_cast<wide_type>(get().l);
+    constexpr static const wide_type max = static_cast<wide_type>(get().u);
+};
+
+template<class T, std::size_t W, bool Negative = (sum_range<T, W>::min < 0)>
+struct sum_type {
+    using P = policy_or<typename get_promotion_policy<T>::type, native>;
+    using E = policy_or<
+        typename get_exception_policy<T>::type,
+        default_exception_policy
+    >;
+    using type = safe_signed_range<
+        static_cast<std::intmax_t>(sum_range<T, W>::min),
+        static_cast<std::intmax_t>(sum_range<T, W>::max),
+        P,
+        E
+    >;
+};
+
+template<class T, std::size_t W>
+struct sum_type<T, W, false> {
+    using P = policy_or<typename get_promotion_policy<T>::type, native>;
+    using E = policy_or<
+        typename get_exception_policy<T>::type,
+        default_exception_policy
+    >;
+    using type = safe_unsigned_range<
+        static_cast<std::uintmax_t>(sum_range<T, W>::min),
+        static_cast<std::uintmax_t>(sum_range<T, W>::max),
+        P,
+        E
+    >;
+};
+
+} // window_detail
+
+template<class T, std::size_t W>
+class safe_window_sum {
+public:
+    using value_type = T;
+    // a safe range type with bounds [W * Min, W * Max]
+    using sum_type = typename window_detail::sum_type<T, W>::type;
+    constexpr static const std::size_t window_size = W;
+
+private:
+    using stored_type = typename base_type<T>::type;
+    using sum_stored_type = typename base_type<sum_type>::type;
+    // the running sum is maintained with modular arithmetic.  Intermediate
+    // values may wrap around but the sum of the values in the window is
+    // always in the range of sum_type so it is recovered exactly.
+    using accumulator_type = typename std::make_unsigned<sum_stored_type>::type;
+
+    std::array<stored_type, W> m_values;
+    std::size_t m_position; // where the next value is to be stored
+    std::size_t m_size;
+    accumulator_type m_sum;
+
+    static accumulator_type as_accumulator(const stored_type & x){
+        return static_cast<accumulator_type>(x);
+    }
+
+public:
+    safe_window_sum() :
+        m_position(0),
+        m_size(0),
+        m_sum(0)
+    {}
+
+    std::size_t size() const {
+        return m_size;
+    }
+    bool empty() const {
+        return m_size == 0;
+    }
+    bool full() const {
+        return m_size == W;
+    }
+    void clear(){
+        m_position = 0;
+        m_size = 0;
+        m_sum = 0;
+    }
+
+    void push(const T & t){
+        const stored_type x = base_value(t);
+        if(full())
+            m_sum = static_cast<accumulator_type>(
+                m_sum - as_accumulator(m_values[m_position])
+            );
+        else
+            ++m_size;
+        m_sum = static_cast<accumulator_type>(m_sum + as_accumulator(x));
+        m_values[m_position] = x;
+        if(++m_position == W)
+            m_position = 0;
+    }
+
+    // push the n values starting at first.  The values are processed in
+    // contiguous runs whose sums are calculated by simple loops which the
+    // compiler can vectorize.
+    void push(const T * first, std::size_t n){
+        if(n >= W){
+            // only the last W values remain in the window
+            first += n - W;
+            clear();
+            n = W;
+        }
+        while(n > 0){
+            const std::size_t m = std::min(n, W - m_position);
+            stored_type * const v = m_values.data() + m_position;
+            accumulator_type added = 0;
+            for(std::size_t i = 0; i < m; ++i)
+                added = static_cast<accumulator_type>(
+                    added + as_accumulator(base_value(first[i]))
+                );
+            if(full()){
+                accumulator_type removed = 0;
+                for(std::size_t i = 0; i < m; ++i)
+                    removed = static_cast<accumulator_type>(
+                        removed + as_accumulator(v[i])
+                    );
+                m_sum = static_cast<accumulator_type>(m_sum - removed);
+            }
+            else{
+                // the window is filled in order so the positions to be
+                // written are all unused
+                m_size += m;
+            }
+            m_sum = static_cast<accumulator_type>(m_sum + added);
+            for(std::size_t i = 0; i < m; ++i)
+                v[i] = base_value(first[i]);
+            m_position += m;
+            if(m_position == W)
+                m_position = 0;
+            first += m;
+            n -= m;
+        }
+    }
+
+    // the sum of the values in the window. No checking is required since
+    // it is always in the range of sum_type
+    sum_type sum() const {
+        return window_detail::make_value<sum_type>(
+            static_cast<sum_stored_type>(m_sum)
+        );
+    }
+
+    // the mean of the values in the window truncated toward zero.  This is
+    // always in the range of T.  The window must not be empty.
+    T mean() const {
+        assert(! empty());
+        using wide_type = typename window_detail::sum_range<T, W>::wide_type;
+        return window_detail::make_value<T>(
+            static_cast<wide_type>(static_cast<sum_stored_type>(m_sum))
+            / static_cast<wide_type>(m_size)
+        );
+    }
+};
+
+template<class T, std::size_t W>
+constexpr const std::size_t safe_window_sum<T, W>::window_size;
+
+namespace window_detail {
+
+// the extreme value of the last W values with respect to Compare.  The
+// queue holds the values which may yet become the extreme value in order
+// of arrival.  Each is better than all those which arrive after it.
+template<class T, std::size_t W, class Compare>
+class window_extremum {
+    static_assert(W > 0, "the window must hold at least one value");
+    using stored_type = typename base_type<T>::type;
+
+    // the queue is a ring buffer.  There are never more than W entries
+    std::array<stored_type, W> m_values;
+    // the sequence number of each value in the queue
+    std::array<std::uintmax_t, W> m_sequence;
+    std::size_t m_head;
+    std::size_t m_length;
+    // number of values pushed since the window was last cleared
+    std::uintmax_t m_count;
+
+    std::size_t slot(const std::size_t & i) const {
+        const std::size_t j = m_head + i;
+        return j < W ? j : j - W;
+    }
+
+public:
+    window_extremum() :
+        m_head(0),
+        m_length(0),
+        m_count(0)
+    {}
+
+    std::size_t size() const {
+        return m_count < W ? static_cast<std::size_t>(m_count) : W;
+    }
+    bool empty() const {
+        return m_count == 0;
+    }
+    bool full() const {
+        return m_count >= W;
+    }
+    void clear(){
+        m_head = 0;
+        m_length = 0;
+        m_count = 0;
+    }
+
+    void push(const T & t){
+        const stored_type x = base_value(t);
+        // values which are no better than x can never be the extreme value
+        while(m_length > 0
+        && ! Compare()(m_values[slot(m_length - 1)], x))
+            --m_length;
+        // the value at the front leaves the window
+        if(m_length > 0 && m_sequence[m_head] + W <= m_count){
+            m_head = slot(1);
+            --m_length;
+        }
+        const std::size_t s = slot(m_length);
+        m_values[s] = x;
+        m_sequence[s] = m_count++;
+        ++m_length;
+    }
+
+    void push(const T * first, const std::size_t & n){
+        // only the last W values can affect the result
+        std::size_t i = n > W ? n - W : 0;
+        if(i > 0)
+            clear();
+        for(; i < n; ++i)
+            push(first[i]);
+    }
+
+    // the window must not be empty
+    T value() const {
+        assert(! empty());
+        return make_value<T>(m_values[m_head]);
+    }
+};
+
+} // window_detail
+
+template<class T, std::size_t W>
+class safe_window_min :
+    public window_detail::window_extremum<
+        T, W, std::less<typename base_type<T>::type>
+    >
+{
+public:
+    T min() const {
+        return this->value();
+    }
+};
+
+template<class T, std::size_t W>
+class safe_window_max :
+    public window_detail::window_extremum<
+        T, W, std::greater<typename base_type<T>::type>
+    >
+{
+public:
+    T max() const {
+        return this->value();
+    }
+};
+
+} // safe_numerics
+} // boost
+
+#endif // BOOST_NUMERIC_SAFE_WINDOW_HPP
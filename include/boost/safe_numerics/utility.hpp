@@ -234,6 +234,34 @@ minmax(const std::initializer_list<T> & l){
     return std::pair<T, T>{* minimum, * maximum};
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// bit counting on 64 bit words. Used by the containers and algorithms
+// which are indexed by the values of a range type
+
+// the number of bits set in t
+constexpr inline unsigned int popcount(const std::uint64_t & t){
+#if defined(__GNUC__) // gcc and clang
+    return static_cast<unsigned int>(__builtin_popcountll(t));
+#else
+    unsigned int count = 0;
+    for(std::uint64_t x = t; x != 0; x &= x - 1)
+        ++count;
+    return count;
+#endif
+}
+
+// the number of trailing zero bits in t. t == 0 returns 64
+constexpr inline unsigned int countr_zero(const std::uint64_t & t){
+    if(t == 0)
+        return 64;
+#if defined(__GNUC__) // gcc and clang
+    return static_cast<unsigned int>(__builtin_ctzll(t));
+#else
+    // isolate the lowest set bit and count the bits below it
+    return popcount((t & (~t + 1)) - 1);
+#endif
+}
+
 // for any given t
 // a) figure number of significant bits
 // b) return a value with all significant bits set
@@ -0,0 +1,18 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// the definitions of the instantiations declared extern in
+// instantiations.hpp
+
+#define BOOST_SAFE_NUMERICS_SOURCE
+#include <boost/safe_numerics/instantiations.hpp>
+
+#define BOOST_SAFE_NUMERICS_DEFINE_INSTANTIATION(T, P, E)             \
+    BOOST_SAFE_NUMERICS_INSTANTIATE(, T, P, E)
+
+BOOST_SAFE_NUMERICS_FOR_EACH_INSTANTIATION(
+    BOOST_SAFE_NUMERICS_DEFINE_INSTANTIATION
+)
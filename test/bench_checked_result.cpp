@@ -0,0 +1,108 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// time chained expressions of checked_result such as those evaluated
+// when propagating bounds or errors through arithmetic at run time
+// usage: bench_checked_result [values]
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS, strtoul
+#include <vector>
+
+#include <boost/safe_numerics/checked_result.hpp>
+#include <boost/safe_numerics/checked_result_operations.hpp>
+
+using namespace boost::safe_numerics;
+
+template<class F>
+double time(F f){
+    // best of three
+    double best = 0;
+    for(int trial = 0; trial < 3; ++trial){
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const std::chrono::duration<double> d =
+            std::chrono::steady_clock::now() - start;
+        if(trial == 0 || d.count() < best)
+            best = d.count();
+    }
+    return best;
+}
+
+int main(int argc, char * argv[]){
+    using T = std::int32_t;
+    using r_type = checked_result<T>;
+    const std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1u << 22;
+
+    std::vector<T> a(n), b(n), c(n);
+    std::uint64_t x = 1;
+    for(std::size_t i = 0; i < n; ++i){
+        x = x * 6364136223846793005u + 1442695040888963407u;
+        a[i] = static_cast<T>(x >> 40) - (T(1) << 23);
+        b[i] = static_cast<T>((x >> 20) & 0xfff) + 1;
+        c[i] = static_cast<T>(x & 0xfffff);
+    }
+
+    std::int64_t sink = 0;
+    // (a * b + c) / b - a with every intermediate result checked
+    const double t_values = time([&]{
+        for(std::size_t i = 0; i < n; ++i){
+            const r_type r =
+                (r_type(a[i]) * r_type(b[i]) + r_type(c[i])) / r_type(b[i])
+                - r_type(a[i]);
+            sink += r.exception() ? 1 : static_cast<T>(r);
+        }
+    });
+    // the same expression starting from an overflow which propagates
+    // through each operation
+    const double t_errors = time([&]{
+        const r_type overflow(
+            safe_numerics_error::positive_overflow_error,
+            "overflow"
+        );
+        for(std::size_t i = 0; i < n; ++i){
+            const r_type r =
+                (overflow * r_type(b[i]) + r_type(c[i])) / r_type(b[i])
+                - r_type(a[i]);
+            sink += r.exception();
+        }
+    });
+    const double t_compare = time([&]{
+        for(std::size_t i = 0; i < n; ++i)
+            sink += static_cast<bool>(r_type(a[i]) < r_type(c[i]))
+                + static_cast<bool>(r_type(b[i]) == r_type(c[i]));
+    });
+    const double t_raw = time([&]{
+        for(std::size_t i = 0; i < n; ++i)
+            sink += (static_cast<std::int64_t>(a[i]) * b[i] + c[i]) / b[i] - a[i];
+    });
+
+    std::cout
+        << "values: " << n << " (" << sink << ")" << std::endl
+        << std::setw(24) << "expression"
+        << std::setw(12) << "seconds"
+        << std::setw(12) << "ns/op"
+        << std::endl;
+    const struct {
+        const char * name;
+        double seconds;
+    } results[] = {
+        {"checked values", t_values},
+        {"checked errors", t_errors},
+        {"checked comparisons", t_compare},
+        {"unchecked int64_t", t_raw}
+    };
+    for(const auto & r : results)
+        std::cout
+            << std::setw(24) << r.name
+            << std::setw(12) << std::fixed << std::setprecision(4) << r.seconds
+            << std::setw(12) << std::setprecision(2) << r.seconds * 1e9 / n
+            << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,395 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// count the instructions, branches, branch misses and cycles per operation
+// of each safe arithmetic, comparison, shift and bitwise operator and
+// policy compared with the same operation on int.  The operands are drawn
+// from one of several distributions:
+//   small     - small positive values
+//   signs     - small values of random sign, so any test of the sign of an
+//               operand is unpredictable
+//   boundary  - the first operand is near the maximum or the minimum
+// Pairs whose result isn't representable are discarded so no operation
+// fails.  The second operand of a shift is reduced to the number of bits
+// of int.  Without access to the hardware counters only the time is shown.
+// usage: bench_counters [values] [small|signs|boundary]
+
+#include <iostream>
+#include <iomanip>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS, strtoul
+#include <cstring> // strcmp
+#include <limits>
+#include <vector>
+
+#include <boost/mp11.hpp>
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/automatic.hpp>
+#include <boost/safe_numerics/exception_policies.hpp>
+
+#include "perf_counters.hpp"
+
+using namespace boost::safe_numerics;
+using namespace boost::mp11;
+
+struct plus {
+    constexpr static const char * name = "+";
+    constexpr static const std::int64_t mask = 1023;
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t + u;
+    }
+    static bool defined(std::int64_t t, std::int64_t u, std::int64_t & r){
+        r = t + u;
+        return true;
+    }
+};
+struct minus {
+    constexpr static const char * name = "-";
+    constexpr static const std::int64_t mask = 1023;
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t - u;
+    }
+    static bool defined(std::int64_t t, std::int64_t u, std::int64_t & r){
+        r = t - u;
+        return true;
+    }
+};
+struct multiplies {
+    constexpr static const char * name = "*";
+    constexpr static const std::int64_t mask = 1023;
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t * u;
+    }
+    static bool defined(std::int64_t t, std::int64_t u, std::int64_t & r){
+        r = t * u;
+        return true;
+    }
+};
+struct divides {
+    constexpr static const char * name = "/";
+    constexpr static const std::int64_t mask = 1023;
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t / u;
+    }
+    static bool defined(std::int64_t t, std::int64_t u, std::int64_t & r){
+        if(u == 0)
+            return false;
+        r = t / u;
+        return true;
+    }
+};
+struct modulus {
+    constexpr static const char * name = "%";
+    constexpr static const std::int64_t mask = 1023;
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t % u;
+    }
+    static bool defined(std::int64_t t, std::int64_t u, std::int64_t & r){
+        // int's minimum % -1 overflows on some machines
+        if(u == 0 || (u == -1 && t == std::numeric_limits<int>::min()))
+            return false;
+        r = t % u;
+        return true;
+    }
+};
+
+struct less {
+    constexpr static const char * name = "<";
+    constexpr static const std::int64_t mask = 1023;
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t < u;
+    }
+    static bool defined(std::int64_t t, std::int64_t u, std::int64_t & r){
+        r = t < u;
+        return true;
+    }
+};
+struct greater {
+    constexpr static const char * name = ">";
+    constexpr static const std::int64_t mask = 1023;
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t > u;
+    }
+    static bool defined(std::int64_t t, std::int64_t u, std::int64_t & r){
+        r = t > u;
+        return true;
+    }
+};
+struct less_equal {
+    constexpr static const char * name = "<=";
+    constexpr static const std::int64_t mask = 1023;
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t <= u;
+    }
+    static bool defined(std::int64_t t, std::int64_t u, std::int64_t & r){
+        r = t <= u;
+        return true;
+    }
+};
+struct greater_equal {
+    constexpr static const char * name = ">=";
+    constexpr static const std::int64_t mask = 1023;
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t >= u;
+    }
+    static bool defined(std::int64_t t, std::int64_t u, std::int64_t & r){
+        r = t >= u;
+        return true;
+    }
+};
+struct equal_to {
+    constexpr static const char * name = "==";
+    constexpr static const std::int64_t mask = 1023;
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t == u;
+    }
+    static bool defined(std::int64_t t, std::int64_t u, std::int64_t & r){
+        r = t == u;
+        return true;
+    }
+};
+struct not_equal_to {
+    constexpr static const char * name = "!=";
+    constexpr static const std::int64_t mask = 1023;
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t != u;
+    }
+    static bool defined(std::int64_t t, std::int64_t u, std::int64_t & r){
+        r = t != u;
+        return true;
+    }
+};
+struct left_shift {
+    constexpr static const char * name = "<<";
+    constexpr static const std::int64_t mask = 31;
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t << u;
+    }
+    static bool defined(std::int64_t t, std::int64_t u, std::int64_t & r){
+        // shifting a negative value is an error for a safe type
+        if(t < 0 || u < 0)
+            return false;
+        r = t << u;
+        return true;
+    }
+};
+struct right_shift {
+    constexpr static const char * name = ">>";
+    constexpr static const std::int64_t mask = 31;
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t >> u;
+    }
+    static bool defined(std::int64_t t, std::int64_t u, std::int64_t & r){
+        if(t < 0 || u < 0)
+            return false;
+        r = t >> u;
+        return true;
+    }
+};
+struct bit_and {
+    constexpr static const char * name = "&";
+    constexpr static const std::int64_t mask = 1023;
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t & u;
+    }
+    static bool defined(std::int64_t t, std::int64_t u, std::int64_t & r){
+        r = t & u;
+        return true;
+    }
+};
+struct bit_or {
+    constexpr static const char * name = "|";
+    constexpr static const std::int64_t mask = 1023;
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t | u;
+    }
+    static bool defined(std::int64_t t, std::int64_t u, std::int64_t & r){
+        r = t | u;
+        return true;
+    }
+};
+struct bit_xor {
+    constexpr static const char * name = "^";
+    constexpr static const std::int64_t mask = 1023;
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t ^ u;
+    }
+    static bool defined(std::int64_t t, std::int64_t u, std::int64_t & r){
+        r = t ^ u;
+        return true;
+    }
+};
+
+using operations = mp_list<
+    plus, minus, multiplies, divides, modulus,
+    less, greater, less_equal, greater_equal, equal_to, not_equal_to,
+    left_shift, right_shift,
+    bit_and, bit_or, bit_xor
+>;
+
+// the types compared
+using types = mp_list<
+    int,
+    safe<int, native, strict_exception_policy>,
+    safe<int, native, runtime_trap_policy>,
+    safe<int, automatic, strict_exception_policy>
+>;
+constexpr const char * type_names[] = {
+    "int",
+    "safe<int> throw",
+    "safe<int> trap",
+    "safe<int> automatic"
+};
+
+enum class distribution {
+    small,
+    signs,
+    boundary
+};
+constexpr const char * distribution_names[] = {
+    "small",
+    "signs",
+    "boundary"
+};
+
+// generate n pairs of operands whose result is an int
+template<class Op>
+void generate(
+    const distribution & d,
+    std::vector<int> & a,
+    std::vector<int> & b,
+    const std::size_t & n
+){
+    a.clear();
+    b.clear();
+    std::uint64_t x = 1;
+    const auto next = [&x]{
+        x = x * 6364136223846793005u + 1442695040888963407u;
+        return x >> 33;
+    };
+    while(a.size() < n){
+        std::int64_t t = next() & 1023;
+        std::int64_t u = next() & Op::mask;
+        switch(d){
+        case distribution::small:
+            break;
+        case distribution::signs:
+            if(next() & 1)
+                t = -t;
+            if(next() & 1)
+                u = -u;
+            break;
+        case distribution::boundary:
+            t = (next() & 1)
+                ? std::numeric_limits<int>::max() - t
+                : std::numeric_limits<int>::min() + t;
+            if(next() & 1)
+                u = -u;
+            break;
+        }
+        std::int64_t r;
+        if(! Op::defined(t, u, r)
+        || r < std::numeric_limits<int>::min()
+        || r > std::numeric_limits<int>::max())
+            continue;
+        a.push_back(static_cast<int>(t));
+        b.push_back(static_cast<int>(u));
+    }
+}
+
+void print_count(const double & count){
+    if(count < 0)
+        std::cout << std::setw(10) << "-";
+    else
+        std::cout << std::setw(10) << std::fixed << std::setprecision(2) << count;
+}
+
+template<class Op>
+void run(
+    perf_counters & counters,
+    const distribution & d,
+    const std::size_t & n,
+    std::int64_t & sink
+){
+    std::vector<int> a, b;
+    generate<Op>(d, a, b, n);
+    mp_for_each<mp_iota<mp_size<types>>>([&](auto i){
+        using T = mp_at<types, decltype(i)>;
+        const std::vector<T> t(a.begin(), a.end());
+        const std::vector<T> u(b.begin(), b.end());
+        const perf_sample s = measure(counters, [&]{
+            for(std::size_t j = 0; j < n; ++j)
+                sink += static_cast<std::int64_t>(base_value(Op()(t[j], u[j])));
+        }, n);
+        std::cout
+            << std::setw(4) << Op::name
+            << std::setw(10) << distribution_names[static_cast<int>(d)]
+            << std::setw(22) << type_names[decltype(i)::value];
+        print_count(s[perf_event::instructions]);
+        print_count(s[perf_event::branches]);
+        print_count(s[perf_event::branch_misses]);
+        print_count(s[perf_event::cycles]);
+        print_count(s.seconds * 1e9);
+        std::cout << std::endl;
+    });
+}
+
+int main(int argc, char * argv[]){
+    const std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1u << 16;
+    std::vector<distribution> distributions = {
+        distribution::small,
+        distribution::signs,
+        distribution::boundary
+    };
+    if(argc > 2){
+        distributions.clear();
+        for(int i = 0; i < 3; ++i)
+            if(std::strcmp(argv[2], distribution_names[i]) == 0)
+                distributions.push_back(static_cast<distribution>(i));
+        if(distributions.empty()){
+            std::cerr << "unknown distribution " << argv[2] << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    perf_counters counters;
+    if(! counters.available())
+        std::cout << "hardware counters not available" << std::endl;
+    std::cout
+        << std::setw(4) << "op"
+        << std::setw(10) << "values"
+        << std::setw(22) << "type"
+        << std::setw(10) << "instr"
+        << std::setw(10) << "branches"
+        << std::setw(10) << "misses"
+        << std::setw(10) << "cycles"
+        << std::setw(10) << "ns"
+        << std::endl;
+    std::int64_t sink = 0;
+    for(const distribution & d : distributions)
+        mp_for_each<operations>([&](auto op){
+            run<decltype(op)>(counters, d, n, sink);
+        });
+    std::cout << "values: " << n << " (" << sink << ")" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,104 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// compare interval multiplication with the constexpr operators of
+// interval.hpp and the run time kernels
+// usage: bench_interval [intervals]
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS, strtoul
+#include <vector>
+
+#include <boost/safe_numerics/checked_result.hpp>
+#include <boost/safe_numerics/checked_result_operations.hpp>
+#include <boost/safe_numerics/interval.hpp>
+#include <boost/safe_numerics/runtime_interval.hpp>
+
+using namespace boost::safe_numerics;
+
+template<class F>
+double time(F f){
+    // best of three
+    double best = 0;
+    for(int trial = 0; trial < 3; ++trial){
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const std::chrono::duration<double> d =
+            std::chrono::steady_clock::now() - start;
+        if(trial == 0 || d.count() < best)
+            best = d.count();
+    }
+    return best;
+}
+
+int main(int argc, char * argv[]){
+    using T = std::int64_t;
+    const std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1u << 22;
+
+    std::vector<T> tl(n), tu(n), ul(n), uu(n), rl(n), ru(n);
+    std::uint64_t x = 1;
+    for(std::size_t i = 0; i < n; ++i){
+        x = x * 6364136223846793005u + 1442695040888963407u;
+        const T a = static_cast<T>(x >> 33) - (T(1) << 30);
+        const T b = static_cast<T>(x & 0xffff);
+        tl[i] = a;
+        tu[i] = a + b;
+        ul[i] = -b;
+        uu[i] = static_cast<T>((x >> 16) & 0xffff);
+    }
+
+    std::size_t sink = 0;
+    const double t_constexpr = time([&]{
+        using r_type = checked_result<T>;
+        for(std::size_t i = 0; i < n; ++i){
+            const interval<r_type> r =
+                interval<r_type>(r_type(tl[i]), r_type(tu[i]))
+                * interval<r_type>(r_type(ul[i]), r_type(uu[i]));
+            sink += r.l.exception() || r.u.exception();
+        }
+    });
+    const double t_scalar = time([&]{
+        for(std::size_t i = 0; i < n; ++i){
+            const interval<checked_result<T>> r = runtime_interval::multiply(
+                interval<T>(tl[i], tu[i]),
+                interval<T>(ul[i], uu[i])
+            );
+            sink += r.l.exception() || r.u.exception();
+        }
+    });
+    const double t_batch = time([&]{
+        sink += runtime_interval::multiply(
+            n,
+            tl.data(), tu.data(), ul.data(), uu.data(),
+            rl.data(), ru.data()
+        );
+    });
+
+    std::cout
+        << "intervals: " << n << " (" << sink << ")" << std::endl
+        << std::setw(24) << "method"
+        << std::setw(12) << "seconds"
+        << std::setw(12) << "ns/op"
+        << std::endl;
+    const struct {
+        const char * name;
+        double seconds;
+    } results[] = {
+        {"interval.hpp operator*", t_constexpr},
+        {"runtime_interval", t_scalar},
+        {"runtime_interval batch", t_batch}
+    };
+    for(const auto & r : results)
+        std::cout
+            << std::setw(24) << r.name
+            << std::setw(12) << std::fixed << std::setprecision(4) << r.seconds
+            << std::setw(12) << std::setprecision(2) << r.seconds * 1e9 / n
+            << std::endl;
+    return EXIT_SUCCESS;
+}
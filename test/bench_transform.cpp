@@ -0,0 +1,76 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// scaling of the parallel checked transform with the number of threads
+// usage: bench_transform [elements [max threads]]
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS, strtoul
+#include <thread>
+#include <vector>
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/safe_transform.hpp>
+
+using namespace boost::safe_numerics;
+
+struct multiply_add {
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t * u + t;
+    }
+};
+
+int main(int argc, char * argv[]){
+    const std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1u << 24;
+    const unsigned int max_threads = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 64;
+
+    std::vector<std::int64_t> a(n), b(n);
+    for(std::size_t i = 0; i < n; ++i){
+        a[i] = static_cast<std::int64_t>(i % 100000);
+        b[i] = static_cast<std::int64_t>(i % 1000) - 500;
+    }
+    std::vector<std::int64_t> r(n);
+
+    std::cout
+        << "elements: " << n
+        << " hardware threads: " << std::thread::hardware_concurrency()
+        << std::endl
+        << std::setw(8) << "threads"
+        << std::setw(12) << "seconds"
+        << std::setw(12) << "speedup"
+        << std::setw(16) << "Melements/s"
+        << std::endl;
+
+    double base = 0;
+    for(unsigned int threads = 1; threads <= max_threads; threads *= 2){
+        // best of three
+        double best = 0;
+        for(int trial = 0; trial < 3; ++trial){
+            const auto start = std::chrono::steady_clock::now();
+            safe_transform(
+                parallel_policy(threads, 1u << 16),
+                multiply_add(), n, r.data(), a.data(), b.data()
+            );
+            const std::chrono::duration<double> d =
+                std::chrono::steady_clock::now() - start;
+            if(trial == 0 || d.count() < best)
+                best = d.count();
+        }
+        if(threads == 1)
+            base = best;
+        std::cout
+            << std::setw(8) << threads
+            << std::setw(12) << std::fixed << std::setprecision(4) << best
+            << std::setw(12) << std::setprecision(2) << base / best
+            << std::setw(16) << std::setprecision(1) << n / best / 1e6
+            << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
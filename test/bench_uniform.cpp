@@ -0,0 +1,96 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// time the generation of uniformly distributed values of a range type
+// usage: bench_uniform [values]
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS, strtoul
+#include <random>
+#include <vector>
+
+#include <boost/safe_numerics/safe_integer_range.hpp>
+#include <boost/safe_numerics/safe_uniform.hpp>
+
+using namespace boost::safe_numerics;
+
+template<class F>
+double time(F f){
+    // best of three
+    double best = 0;
+    for(int trial = 0; trial < 3; ++trial){
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const std::chrono::duration<double> d =
+            std::chrono::steady_clock::now() - start;
+        if(trial == 0 || d.count() < best)
+            best = d.count();
+    }
+    return best;
+}
+
+int main(int argc, char * argv[]){
+    using T = safe_signed_range<-1000, 999>;
+    using stored_type = safe_uniform<T>::stored_type;
+    const std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1u << 22;
+
+    std::vector<stored_type> out(n);
+    std::int64_t sink = 0;
+
+    // the usual way - a distribution followed by a checked construction
+    const double t_std = time([&]{
+        std::mt19937 g(1);
+        std::uniform_int_distribution<int> d(-1000, 999);
+        for(std::size_t i = 0; i < n; ++i)
+            out[i] = base_value(T(d(g)));
+        sink += out[n / 2];
+    });
+    const double t_mt = time([&]{
+        std::mt19937 g(1);
+        safe_uniform<T> u;
+        for(std::size_t i = 0; i < n; ++i)
+            out[i] = base_value(u(g));
+        sink += out[n / 2];
+    });
+    const double t_counter = time([&]{
+        counter_engine g(1);
+        safe_uniform<T> u;
+        for(std::size_t i = 0; i < n; ++i)
+            out[i] = base_value(u(g));
+        sink += out[n / 2];
+    });
+    const double t_generate = time([&]{
+        counter_engine g(1);
+        safe_uniform<T>::generate(out.data(), n, g);
+        sink += out[n / 2];
+    });
+
+    std::cout
+        << "values: " << n << " (" << sink << ")" << std::endl
+        << std::setw(32) << "method"
+        << std::setw(12) << "seconds"
+        << std::setw(12) << "ns/value"
+        << std::endl;
+    const struct {
+        const char * name;
+        double seconds;
+    } results[] = {
+        {"uniform_int_distribution", t_std},
+        {"safe_uniform mt19937", t_mt},
+        {"safe_uniform counter_engine", t_counter},
+        {"generate counter_engine", t_generate}
+    };
+    for(const auto & r : results)
+        std::cout
+            << std::setw(32) << r.name
+            << std::setw(12) << std::fixed << std::setprecision(4) << r.seconds
+            << std::setw(12) << std::setprecision(2) << r.seconds * 1e9 / n
+            << std::endl;
+    return EXIT_SUCCESS;
+}
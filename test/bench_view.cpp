@@ -0,0 +1,92 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// time the conversion of a range of int to a range type by validating
+// each element and by a safe_cast view which validates them in place
+// usage: bench_view [values]
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS, strtoul
+#include <vector>
+
+#include <boost/safe_numerics/safe_integer_range.hpp>
+#include <boost/safe_numerics/safe_view.hpp>
+
+using namespace boost::safe_numerics;
+
+template<class F>
+double time(F f){
+    // best of three
+    double best = 0;
+    for(int trial = 0; trial < 3; ++trial){
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const std::chrono::duration<double> d =
+            std::chrono::steady_clock::now() - start;
+        if(trial == 0 || d.count() < best)
+            best = d.count();
+    }
+    return best;
+}
+
+int main(int argc, char * argv[]){
+    using T = safe_signed_range<-1000, 999>;
+    const std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1u << 22;
+
+    std::vector<int> in(n);
+    std::uint64_t x = 1;
+    for(std::size_t i = 0; i < n; ++i){
+        x = x * 6364136223846793005u + 1442695040888963407u;
+        in[i] = static_cast<int>((x >> 33) % 2000) - 1000;
+    }
+    std::int64_t sink = 0;
+
+    // no validation at all
+    const double t_raw = time([&]{
+        std::int64_t s = 0;
+        for(const int & i : in)
+            s += i;
+        sink += s;
+    });
+    // the usual way - a checked construction of each element
+    const double t_element = time([&]{
+        std::int64_t s = 0;
+        for(const int & i : in)
+            s += base_value(T(i));
+        sink += s;
+    });
+    const double t_view = time([&]{
+        std::int64_t s = 0;
+        for(const T & t : in | views::safe_cast<T>)
+            s += base_value(t);
+        sink += s;
+    });
+
+    std::cout
+        << "values: " << n << " (" << sink << ")" << std::endl
+        << std::setw(24) << "method"
+        << std::setw(12) << "seconds"
+        << std::setw(12) << "ns/value"
+        << std::endl;
+    const struct {
+        const char * name;
+        double seconds;
+    } results[] = {
+        {"unchecked", t_raw},
+        {"validated per element", t_element},
+        {"safe_cast view", t_view}
+    };
+    for(const auto & r : results)
+        std::cout
+            << std::setw(24) << r.name
+            << std::setw(12) << std::fixed << std::setprecision(4) << r.seconds
+            << std::setw(12) << std::setprecision(2) << r.seconds * 1e9 / n
+            << std::endl;
+    return EXIT_SUCCESS;
+}
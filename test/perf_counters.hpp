@@ -0,0 +1,185 @@
+#ifndef BOOST_SAFE_NUMERICS_TEST_PERF_COUNTERS_HPP
+#define BOOST_SAFE_NUMERICS_TEST_PERF_COUNTERS_HPP
+
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// hardware performance counters for the benchmarks.  On Linux the
+// counters are read with perf_event_open.  Elsewhere, or when the kernel
+// refuses access (see /proc/sys/kernel/perf_event_paranoid), no counter
+// is available and only the elapsed time is measured.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <cstring> // memset
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+enum class perf_event {
+    instructions,
+    branches,
+    branch_misses,
+    cycles
+};
+constexpr const std::size_t perf_event_count = 4;
+
+// a group of the above counters which are started and stopped together
+class perf_counters {
+public:
+    perf_counters(){
+        for(std::size_t i = 0; i < perf_event_count; ++i){
+            m_fd[i] = -1;
+            m_value[i] = 0;
+            m_counted[i] = false;
+        }
+        #if defined(__linux__)
+        static const std::uint64_t config[perf_event_count] = {
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_BRANCH_INSTRUCTIONS,
+            PERF_COUNT_HW_BRANCH_MISSES,
+            PERF_COUNT_HW_CPU_CYCLES
+        };
+        for(std::size_t i = 0; i < perf_event_count; ++i){
+            perf_event_attr a;
+            std::memset(&a, 0, sizeof(a));
+            a.type = PERF_TYPE_HARDWARE;
+            a.size = sizeof(a);
+            a.config = config[i];
+            a.disabled = leader() == -1;
+            a.exclude_kernel = 1;
+            a.exclude_hv = 1;
+            a.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID
+                | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            // a counter which can't be opened is skipped - a virtual
+            // machine may provide some counters but not others
+            m_fd[i] = static_cast<int>(
+                syscall(__NR_perf_event_open, &a, 0, -1, leader(), 0)
+            );
+            if(m_fd[i] != -1)
+                ioctl(m_fd[i], PERF_EVENT_IOC_ID, &m_id[i]);
+        }
+        #endif
+    }
+    ~perf_counters(){
+        #if defined(__linux__)
+        for(int fd : m_fd)
+            if(fd != -1)
+                close(fd);
+        #endif
+    }
+    perf_counters(const perf_counters &) = delete;
+    perf_counters & operator=(const perf_counters &) = delete;
+
+    bool available(const perf_event & e) const {
+        return m_fd[index(e)] != -1;
+    }
+    bool available() const {
+        return leader() != -1;
+    }
+    // true if e was counted during the last interval
+    bool counted(const perf_event & e) const {
+        return m_counted[index(e)];
+    }
+    void start(){
+        #if defined(__linux__)
+        if(available()){
+            ioctl(leader(), PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(leader(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+        #endif
+        m_start = std::chrono::steady_clock::now();
+    }
+    void stop(){
+        const auto now = std::chrono::steady_clock::now();
+        m_seconds = std::chrono::duration<double>(now - m_start).count();
+        for(bool & c : m_counted)
+            c = false;
+        #if defined(__linux__)
+        if(! available())
+            return;
+        ioctl(leader(), PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        // nr, time enabled, time running then a value and id per counter
+        std::uint64_t buffer[3 + 2 * perf_event_count];
+        if(read(leader(), buffer, sizeof(buffer)) < 24)
+            return;
+        // if the group was never scheduled nothing was counted
+        if(buffer[2] == 0)
+            return;
+        // scale the counts if the group was multiplexed with other events
+        const double scale = static_cast<double>(buffer[1]) / buffer[2];
+        for(std::size_t j = 0; j < buffer[0]; ++j)
+            for(std::size_t i = 0; i < perf_event_count; ++i)
+                if(m_fd[i] != -1 && m_id[i] == buffer[4 + 2 * j]){
+                    m_value[i] = static_cast<std::uint64_t>(
+                        buffer[3 + 2 * j] * scale
+                    );
+                    m_counted[i] = true;
+                }
+        #endif
+    }
+    // the count of the last interval between start and stop
+    std::uint64_t operator[](const perf_event & e) const {
+        return m_value[index(e)];
+    }
+    double seconds() const {
+        return m_seconds;
+    }
+private:
+    static std::size_t index(const perf_event & e){
+        return static_cast<std::size_t>(e);
+    }
+    int leader() const {
+        for(int fd : m_fd)
+            if(fd != -1)
+                return fd;
+        return -1;
+    }
+    int m_fd[perf_event_count];
+    std::uint64_t m_id[perf_event_count];
+    std::uint64_t m_value[perf_event_count];
+    bool m_counted[perf_event_count];
+    std::chrono::steady_clock::time_point m_start;
+    double m_seconds = 0;
+};
+
+// the counts per operation of the best of several runs of f which
+// performs n operations.  A count which wasn't counted, because the
+// counter isn't available or the kernel never scheduled it, is negative.
+struct perf_sample {
+    double value[perf_event_count];
+    double seconds;
+    double operator[](const perf_event & e) const {
+        return value[static_cast<std::size_t>(e)];
+    }
+};
+
+template<class F>
+perf_sample measure(perf_counters & c, F f, const std::size_t & n, int trials = 3){
+    perf_sample best;
+    for(int trial = 0; trial < trials; ++trial){
+        c.start();
+        f();
+        c.stop();
+        if(trial > 0 && c.seconds() >= best.seconds * n)
+            continue;
+        for(std::size_t i = 0; i < perf_event_count; ++i){
+            const perf_event e = static_cast<perf_event>(i);
+            best.value[i] = c.counted(e)
+                ? static_cast<double>(c[e]) / n
+                : -1;
+        }
+        best.seconds = c.seconds() / n;
+    }
+    return best;
+}
+
+#endif // BOOST_SAFE_NUMERICS_TEST_PERF_COUNTERS_HPP
@@ -0,0 +1,123 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test evaluation of expressions over columns with check elision
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <limits>
+#include <system_error>
+#include <utility> // pair
+#include <vector>
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/batch.hpp>
+
+using namespace boost::safe_numerics;
+
+// a * b + c
+struct multiply_add {
+    template<class T>
+    T operator()(const T & a, const T & b, const T & c) const {
+        return a * b + c;
+    }
+};
+
+constexpr const std::size_t n = 4 * batch_block_size;
+
+bool test_elision(){
+    std::vector<std::int64_t> a(n), b(n), c(n), r(n);
+    for(std::size_t i = 0; i < n; ++i){
+        a[i] = static_cast<std::int64_t>(i);
+        b[i] = -static_cast<std::int64_t>(i % 1000);
+        c[i] = 7;
+    }
+    // block 2 has large values which may overflow but don't
+    a[2 * batch_block_size] = std::int64_t(1) << 40;
+    b[2 * batch_block_size + 1] = std::int64_t(1) << 40;
+
+    const batch_statistics s = batch_evaluate(
+        multiply_add(), n, r.data(), a.data(), b.data(), c.data()
+    );
+    if(s.m_unchecked_blocks != 3 || s.m_checked_blocks != 1)
+        return false;
+    for(std::size_t i = 0; i < n; ++i)
+        if(r[i] != a[i] * b[i] + c[i])
+            return false;
+
+    // provoke an overflow in block 3
+    a[3 * batch_block_size] = std::numeric_limits<std::int64_t>::max() / 2;
+    b[3 * batch_block_size] = 3;
+    try{
+        batch_evaluate(multiply_add(), n, r.data(), a.data(), b.data(), c.data());
+        std::cout << "failed to detect overflow" << std::endl;
+        return false;
+    }
+    catch(const std::system_error &){}
+    return true;
+}
+
+// the result can be narrower than the columns
+bool test_narrowing(){
+    using result_type = safe<std::int32_t>;
+    std::vector<safe<std::int64_t>> a(n, 1000), b(n, 1000), c(n, 0);
+    std::vector<result_type> r(n, 0);
+    // precomputed statistics
+    std::vector<std::pair<std::int64_t, std::int64_t>>
+        za(n / batch_block_size), zb(n / batch_block_size), zc(n / batch_block_size);
+    make_zone_map(a.data(), n, za.data());
+    make_zone_map(b.data(), n, zb.data());
+    make_zone_map(c.data(), n, zc.data());
+    batch_statistics s = batch_evaluate(
+        multiply_add(), n, batch_block_size, r.data(),
+        make_batch_column(a.data(), za.data()),
+        make_batch_column(b.data(), zb.data()),
+        make_batch_column(c.data(), zc.data())
+    );
+    if(s.m_unchecked_blocks != 4 || r[n - 1] != 1000000)
+        return false;
+    // the product is in range of the columns but not of the result
+    a[5] = 10000000;
+    make_zone_map(a.data(), n, za.data());
+    try{
+        batch_evaluate(
+            multiply_add(), n, batch_block_size, r.data(),
+            make_batch_column(a.data(), za.data()),
+            make_batch_column(b.data(), zb.data()),
+            make_batch_column(c.data(), zc.data())
+        );
+        std::cout << "failed to detect narrowing" << std::endl;
+        return false;
+    }
+    catch(const std::system_error &){}
+    return true;
+}
+
+// directly test the range calculation
+bool test_fits(){
+    multiply_add f;
+    using bounds = std::pair<std::int32_t, std::int32_t>;
+    if(! batch_fits<std::int32_t, std::int32_t>(f, bounds(-10, 10), bounds(-10, 10), bounds(0, 0)))
+        return false;
+    if(batch_fits<std::int8_t, std::int32_t>(f, bounds(-10, 10), bounds(-13, 13), bounds(0, 0)))
+        return false;
+    if(batch_fits<std::int32_t, std::int32_t>(f, bounds(-65536, 0), bounds(-65536, 0), bounds(0, 0)))
+        return false;
+    // unsigned results exclude negative values
+    if(batch_fits<std::uint32_t, std::int32_t>(f, bounds(-1, 1), bounds(1, 1), bounds(0, 0)))
+        return false;
+    return true;
+}
+
+int main(){
+    bool rval =
+        test_elision() &&
+        test_narrowing() &&
+        test_fits();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -14,23 +14,23 @@ constexpr const char *test_compare_automatic_result[
 //      0       0       0       0
 //      012345670123456701234567012345670
 //      012345678901234567890123456789012
-/* 0*/ "=<>>=<>>=<>>=<>>=<<<=<<<=<<<=<xx>",
-/* 1*/ ">=>>><>>><>>><>>>=<<><<<><<<><xx>",
-/* 2*/ "<<=<<<><<<><<<><<<<<<<<<<<<<<<xx<",
-/* 3*/ "<<>=<<>=<<>=<<>=<<<<<<<<<<<<<<xx<",
-/* 4*/ "=<>>=<>>=<>>=<>>=<<<=<<<=<<<=<xx>",
-/* 5*/ ">>>>>=>>><>>><>>>>>>>=<<><<<><xx>",
-/* 6*/ "<<<<<<=<<<><<<><<<<<<<<<<<<<<<xx<",
-/* 7*/ "<<>=<<>=<<>=<<>=<<<<<<<<<<<<<<xx<",
+/* 0*/ "=<>>=<>>=<>>=<>>=<<<=<<<=<<<=<<<>",
+/* 1*/ ">=>>><>>><>>><>>>=<<><<<><<<><<<>",
+/* 2*/ "<<=<<<><<<><<<><<<<<<<<<<<<<<<<<<",
+/* 3*/ "<<>=<<>=<<>=<<>=<<<<<<<<<<<<<<<<<",
+/* 4*/ "=<>>=<>>=<>>=<>>=<<<=<<<=<<<=<<<>",
+/* 5*/ ">>>>>=>>><>>><>>>>>>>=<<><<<><<<>",
+/* 6*/ "<<<<<<=<<<><<<><<<<<<<<<<<<<<<<<<",
+/* 7*/ "<<>=<<>=<<>=<<>=<<<<<<<<<<<<<<<<<",
 
-/* 8*/ "=<>>=<>>=<>>=<>>=<<<=<<<=<<<=<xx>",
-/* 9*/ ">>>>>>>>>=>>><>>>>>>>>>>>=<<><xx>",
-/*10*/ "<<<<<<<<<<=<<<><<<<<<<<<<<<<<<xx<",
-/*11*/ "<<>=<<>=<<>=<<>=<<<<<<<<<<<<<<xx<",
-/*12*/ "=<>>=<>>=<>>=<>>=<<<=<<<=<<<=<xx>",
-/*13*/ ">>>>>>>>>>>>>=>>>>>>>>>>>>>>>=xx>",
-/*14*/ "<<<<<<<<<<<<<<=<<<<<<<<<<<<<<<xx<",
-/*15*/ "<<>=<<>=<<>=<<>=<<<<<<<<<<<<<<xx<",
+/* 8*/ "=<>>=<>>=<>>=<>>=<<<=<<<=<<<=<<<>",
+/* 9*/ ">>>>>>>>>=>>><>>>>>>>>>>>=<<><<<>",
+/*10*/ "<<<<<<<<<<=<<<><<<<<<<<<<<<<<<<<<",
+/*11*/ "<<>=<<>=<<>=<<>=<<<<<<<<<<<<<<<<<",
+/*12*/ "=<>>=<>>=<>>=<>>=<<<=<<<=<<<=<<<>",
+/*13*/ ">>>>>>>>>>>>>=>>>>>>>>>>>>>>>=<<>",
+/*14*/ "<<<<<<<<<<<<<<=<<<<<<<<<<<<<<<<<<",
+/*15*/ "<<>=<<>=<<>=<<>=<<<<<<<<<<<<<<<<<",
 
 //      0       0       0       0
 //      012345670123456701234567012345670
@@ -50,7 +50,7 @@ constexpr const char *test_compare_automatic_result[
 /*27*/ ">>>>>>>>>>>>><>>>>>>>>>>>>>=><<<>",
 /*28*/ "=<>>=<>>=<>>=<>>=<<<=<<<=<<<=<<<>",
 /*29*/ ">>>>>>>>>>>>>=>>>>>>>>>>>>>>>=<<>",
-/*30*/ "xxxxxxxxxxxxxxxx>>>>>>>>>>>>>>=<x",
-/*31*/ "xxxxxxxxxxxxxxxx>>>>>>>>>>>>>>>=x",
-/*32*/ "<<>><<>><<>><<>><<<<<<<<<<<<<<xx="
+/*30*/ ">>>>>>>>>>>>>>>>>>>>>>>>>>>>>>=<>",
+/*31*/ ">>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>=>",
+/*32*/ "<<>><<>><<>><<>><<<<<<<<<<<<<<<<="
 };
@@ -8,21 +8,21 @@ constexpr const char *test_compare_native_result[
 //      012345678901234567890123456789012
 /* 0*/ "=<>>=<>>=<>>=<>>=<<<=<<<=<<<=<<<>",
 /* 1*/ ">=>>><>>><>>><>>>=<<><<<><<<><<<>",
-/* 2*/ "<<=<<<><<<><<<><<<<<<<<<xxxxxxxx<",
-/* 3*/ "<<>=<<>=<<>=<<>=<<<<<<<<xxxxxxxx<",
+/* 2*/ "<<=<<<><<<><<<><<<<<<<<<<<<<<<<<<",
+/* 3*/ "<<>=<<>=<<>=<<>=<<<<<<<<<<<<<<<<<",
 /* 4*/ "=<>>=<>>=<>>=<>>=<<<=<<<=<<<=<<<>",
 /* 5*/ ">>>>>=>>><>>><>>>>>>>=<<><<<><<<>",
-/* 6*/ "<<<<<<=<<<><<<><<<<<<<<<xxxxxxxx<",
-/* 7*/ "<<>=<<>=<<>=<<>=<<<<<<<<xxxxxxxx<",
+/* 6*/ "<<<<<<=<<<><<<><<<<<<<<<<<<<<<<<<",
+/* 7*/ "<<>=<<>=<<>=<<>=<<<<<<<<<<<<<<<<<",
 
 /* 8*/ "=<>>=<>>=<>>=<>>=<<<=<<<=<<<=<<<>",
 /* 9*/ ">>>>>>>>>=>>><>>>>>>>>>>>=<<><<<>",
-/*10*/ "<<<<<<<<<<=<<<><<<<<<<<<xxxxxxxx<",
-/*11*/ "<<>=<<>=<<>=<<>=<<<<<<<<xxxxxxxx<",
+/*10*/ "<<<<<<<<<<=<<<><<<<<<<<<<<<<<<<<<",
+/*11*/ "<<>=<<>=<<>=<<>=<<<<<<<<<<<<<<<<<",
 /*12*/ "=<>>=<>>=<>>=<>>=<<<=<<<=<<<=<<<>",
 /*13*/ ">>>>>>>>>>>>>=>>>>>>>>>>>>>>>=<<>",
-/*14*/ "<<<<<<<<<<<<<<=<<<<<<<<<<<<<xxxx<",
-/*15*/ "<<>=<<>=<<>=<<>=<<<<<<<<<<<<xxxx<",
+/*14*/ "<<<<<<<<<<<<<<=<<<<<<<<<<<<<<<<<<",
+/*15*/ "<<>=<<>=<<>=<<>=<<<<<<<<<<<<<<<<<",
 
 //      0       0       0       0
 //      012345670123456701234567012345670
@@ -36,13 +36,13 @@ constexpr const char *test_compare_native_result[
 /*22*/ ">>>>>>>>><>>><>>>>>>>>=<><<<><<<>",
 /*23*/ ">>>>>>>>><>>><>>>>>>>>>=><<<><<<>",
 
-/*24*/ "=<xx=<xx=<xx=<>>=<<<=<<<=<<<=<<<>",
-/*25*/ ">>xx>>xx>=xx><>>>>>>>>>>>=<<><<<>",
-/*26*/ ">>xx>>xx>>xx><>>>>>>>>>>>>=<><<<>",
-/*27*/ ">>xx>>xx>>xx><>>>>>>>>>>>>>=><<<>",
-/*28*/ "=<xx=<xx=<xx=<xx=<<<=<<<=<<<=<<<>",
-/*29*/ ">>xx>>xx>>xx>=xx>>>>>>>>>>>>>=<<>",
-/*30*/ ">>xx>>xx>>xx>>xx>>>>>>>>>>>>>>=<>",
-/*31*/ ">>xx>>xx>>xx>>xx>>>>>>>>>>>>>>>=>",
+/*24*/ "=<>>=<>>=<>>=<>>=<<<=<<<=<<<=<<<>",
+/*25*/ ">>>>>>>>>=>>><>>>>>>>>>>>=<<><<<>",
+/*26*/ ">>>>>>>>>>>>><>>>>>>>>>>>>=<><<<>",
+/*27*/ ">>>>>>>>>>>>><>>>>>>>>>>>>>=><<<>",
+/*28*/ "=<>>=<>>=<>>=<>>=<<<=<<<=<<<=<<<>",
+/*29*/ ">>>>>>>>>>>>>=>>>>>>>>>>>>>>>=<<>",
+/*30*/ ">>>>>>>>>>>>>>>>>>>>>>>>>>>>>>=<>",
+/*31*/ ">>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>=>",
 /*32*/ "<<>><<>><<>><<>><<<<<<<<<<<<<<<<="
 };
@@ -0,0 +1,165 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test safe integers with congruence tracking
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <limits>
+#include <sstream>
+#include <system_error>
+#include <type_traits>
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/safe_integer_literal.hpp>
+#include <boost/safe_numerics/safe_congruence.hpp>
+
+using namespace boost::safe_numerics;
+
+using offset = safe_aligned<std::int32_t, 8>;
+using odd = safe_congruent<std::int32_t, 2, 1>;
+
+template<class T>
+constexpr std::uintmax_t modulus(){
+    return congruence_detail::congruence<typename std::decay<T>::type>::get().m;
+}
+template<class T>
+constexpr std::uintmax_t residue(){
+    return congruence_detail::congruence<typename std::decay<T>::type>::get().r;
+}
+
+static_assert(
+    std::numeric_limits<offset>::max() == std::numeric_limits<std::int32_t>::max() - 7,
+    "aligned range"
+);
+
+using tracked = safe_congruent<std::int32_t, 1>;
+
+bool test_propagation(){
+    const offset a = 16;
+    const offset b = -24;
+    const tracked n = 5;
+    constexpr const safe_signed_literal<4> four;
+    constexpr const safe_signed_literal<2> two;
+    constexpr const safe_signed_literal<3> three;
+    const odd o = 7;
+
+    const auto sum = a + b;
+    const auto scaled = n * four;        // 4 n
+    const auto mixed = a + scaled;       // 8 k + 4 n
+    const auto shifted = (n >> two) << two;
+    const auto offset_odd = a + o;       // 8 k + 2 j + 1
+    const auto product = o * o;
+    const auto masked = n & safe_signed_literal<-4>();
+    const auto low = a & n;
+    const auto plus_two = a + two;
+
+    using sum_type = decltype(sum);
+    using scaled_type = decltype(scaled);
+    using mixed_type = decltype(mixed);
+    using shifted_type = decltype(shifted);
+    using offset_odd_type = decltype(offset_odd);
+    using product_type = decltype(product);
+    using masked_type = decltype(masked);
+    using low_type = decltype(low);
+    using plus_two_type = decltype(plus_two);
+
+    static_assert(modulus<sum_type>() == 8 && residue<sum_type>() == 0, "+");
+    static_assert(modulus<scaled_type>() == 4 && residue<scaled_type>() == 0, "*");
+    static_assert(modulus<mixed_type>() == 4 && residue<mixed_type>() == 0, "+");
+    static_assert(modulus<shifted_type>() == 4 && residue<shifted_type>() == 0, "<<");
+    static_assert(
+        modulus<offset_odd_type>() == 2 && residue<offset_odd_type>() == 1,
+        "+"
+    );
+    static_assert(modulus<product_type>() == 2 && residue<product_type>() == 1, "*");
+    static_assert(modulus<masked_type>() == 4 && residue<masked_type>() == 0, "&");
+    static_assert(modulus<low_type>() == 8 && residue<low_type>() == 0, "&");
+    static_assert(
+        modulus<plus_two_type>() == 8 && residue<plus_two_type>() == 2,
+        "+"
+    );
+    static_assert(modulus<decltype(a - o)>() == 2 && residue<decltype(a - o)>() == 1, "-");
+    static_assert(modulus<decltype(a >> three)>() == 1, ">>");
+    static_assert(modulus<decltype(a >> two)>() == 2, ">>");
+    static_assert(modulus<decltype(n << three)>() == 8, "<<");
+    static_assert(modulus<decltype(a + n)>() == 1, "+");
+
+    return
+        sum == -8 && scaled == 20 && mixed == 36 && shifted == 4
+        && offset_odd == 23 && product == 49 && masked == 4 && low == 0
+        && plus_two == 18
+        // alignment is known at compile time
+        && is_aligned<8>(mixed - scaled) && is_aligned<4>(scaled)
+        // or tested at run time
+        && is_aligned<4>(n - 1) && ! is_aligned<4>(n);
+}
+
+// exhaustive comparison with the actual values of the results.  Note
+// that negative values can't be shifted.
+template<class Op>
+bool test_exhaustive(Op op, const int first = -1992){
+    using small = safe_congruent<std::int16_t, 12, 4>;
+    using small2 = safe_congruent<std::int16_t, 6, 3>;
+    for(int i = first; i <= 1992; i += 12)
+    for(int j = -996; j <= 996; j += 6){
+        const small t = i + 4;
+        const small2 u = j + 3;
+        const auto r = op(t, u);
+        using r_type = typename std::decay<decltype(r)>::type;
+        if(congruence_detail::residue(
+            congruence_detail::exact(base_value(r)),
+            modulus<r_type>()
+        ) != residue<r_type>())
+            return false;
+    }
+    return true;
+}
+
+bool test_validation(){
+    offset a = 8;
+    try{
+        a = 12;
+        return false;
+    }
+    catch(const std::system_error &){}
+    try{
+        ++a;
+        return false;
+    }
+    catch(const std::system_error &){}
+    try{
+        const odd o(-4);
+        return false;
+    }
+    catch(const std::system_error &){}
+    // negative values
+    const odd o = -5;
+    a += safe_signed_literal<-16>();
+    std::ostringstream os;
+    os << a << ' ' << o;
+    return a == -8 && os.str() == "-8 -5";
+}
+
+int main(){
+    std::cout << "test congruence" << std::endl;
+    const bool rval =
+        test_propagation()
+        && test_exhaustive([](const auto & t, const auto & u){ return t + u; })
+        && test_exhaustive([](const auto & t, const auto & u){ return t - u; })
+        && test_exhaustive([](const auto & t, const auto & u){ return t * u; })
+        && test_exhaustive([](const auto & t, const auto & u){ return t & u; })
+        && test_exhaustive([](const auto & t, const auto &){
+            return t << safe_signed_literal<3>();
+        }, 0)
+        && test_exhaustive([](const auto & t, const auto &){
+            return t >> safe_signed_literal<2>();
+        }, 0)
+        && test_validation();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,77 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test the conversion of safe integers to built in types.  Conversion to
+// the stored type can't fail and makes a safe integer usable where the
+// language requires a built in integer such as an array subscript.
+// Conversion to any other type is checked.
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <system_error>
+#include <type_traits>
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/safe_integer_range.hpp>
+
+using namespace boost::safe_numerics;
+
+static_assert(
+    std::is_convertible<safe<int>, int>::value,
+    "safe<int> converts to int"
+);
+static_assert(
+    std::is_convertible<safe<std::uint8_t>, long>::value,
+    "safe types convert to other integer types"
+);
+
+// a safe integer may subscript an array
+bool test_subscript(){
+    const int a[4] = {10, 20, 30, 40};
+    const safe<int> i = 2;
+    const safe_unsigned_range<0, 3> j = 3;
+    const safe<std::uint8_t> k = 1;
+    return a[i] == 30 && a[j] == 40 && a[k] == 20;
+}
+
+// conversion to the stored type and to a wider type is exact
+bool test_exact(){
+    const safe<int> i = -7;
+    const int ii = i;
+    const long l = i;
+    const safe<std::uint8_t> u = 255;
+    const unsigned int uu = u;
+    return ii == -7 && l == -7 && uu == 255 && static_cast<int>(i) == -7;
+}
+
+// conversion to a type which can't hold the value is an error
+bool test_checked(){
+    const safe<int> i = 300;
+    try{
+        const std::uint8_t u = i;
+        (void)u;
+        return false;
+    }
+    catch(const std::system_error &){}
+    const safe<int> n = -1;
+    try{
+        const unsigned int u = n;
+        (void)u;
+        return false;
+    }
+    catch(const std::system_error &){}
+    return true;
+}
+
+int main(){
+    const bool rval =
+        test_subscript() &&
+        test_exact() &&
+        test_checked();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,161 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test convolution with compile time kernels
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <limits>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/safe_convolve.hpp>
+
+using namespace boost::safe_numerics;
+
+using pixel = safe<std::uint8_t>;
+
+using smooth = kernel<1, 2, 1>;
+using blur = normalized<kernel2d<3, 3, 1, 2, 1, 2, 4, 2, 1, 2, 1>, 4>;
+using sobel = kernel2d<3, 3, -1, 0, 1, -2, 0, 2, -1, 0, 1>;
+
+// result ranges are exact
+template<class K, class T, std::intmax_t Min, std::intmax_t Max>
+constexpr bool check_range(){
+    using R = convolution_result_type<K, T>;
+    return
+        base_value(std::numeric_limits<R>::min()) == Min
+        && base_value(std::numeric_limits<R>::max()) == Max;
+}
+static_assert(check_range<smooth, pixel, 0, 1020>(), "incorrect range");
+static_assert(check_range<blur, pixel, 0, 255>(), "incorrect range");
+static_assert(check_range<sobel, pixel, -1020, 1020>(), "incorrect range");
+static_assert(
+    check_range<normalized<sobel, 3>, pixel, -128, 127>(),
+    "incorrect range"
+);
+// and held in the smallest suitable type
+static_assert(
+    std::is_same<
+        base_type<convolution_result_type<smooth, pixel>>::type,
+        std::uint16_t
+    >::value,
+    "incorrect result type"
+);
+static_assert(
+    std::is_same<
+        base_type<convolution_result_type<sobel, pixel>>::type,
+        std::int16_t
+    >::value,
+    "incorrect result type"
+);
+
+// an image of rows x cols pixels with some extreme values
+std::vector<pixel> make_image(const std::size_t & rows, const std::size_t & cols){
+    std::vector<pixel> image;
+    std::uint32_t x = 1;
+    for(std::size_t i = 0; i < rows * cols; ++i){
+        x = x * 1103515245u + 12345u;
+        image.push_back(
+            static_cast<std::uint8_t>(i % 7 == 0 ? 255 : (x >> 16) & 0xff)
+        );
+    }
+    return image;
+}
+
+template<class K>
+std::intmax_t reference(
+    const std::vector<pixel> & image,
+    const std::size_t & cols,
+    const std::size_t & r,
+    const std::size_t & c
+){
+    std::intmax_t s = 0;
+    for(std::size_t i = 0; i < K::rows; ++i)
+        for(std::size_t j = 0; j < K::cols; ++j)
+            s += K::coefficient(i * K::cols + j)
+                * base_value(image[(r + i) * cols + c + j]);
+    // floor division
+    const std::intmax_t d = std::intmax_t(1) << K::shift;
+    return s >= 0 ? s / d : -((-s + d - 1) / d);
+}
+
+bool test_1d(){
+    const std::vector<pixel> signal = make_image(1, 1000);
+    std::vector<convolution_result_type<smooth, pixel>> out(1000, 0);
+    const std::size_t n = safe_convolve<smooth>(signal.data(), signal.size(), out.data());
+    if(n != 998)
+        return false;
+    for(std::size_t i = 0; i < n; ++i)
+        if(out[i] != reference<smooth>(signal, 1000, 0, i))
+            return false;
+    // too short
+    return safe_convolve<smooth>(signal.data(), 2, out.data()) == 0;
+}
+
+// rows longer than a tile
+constexpr const std::size_t rows = 37;
+constexpr const std::size_t cols = 600;
+
+template<class K, class R>
+bool test_2d(){
+    const std::vector<pixel> image = make_image(rows, cols);
+    std::vector<R> out((rows - 2) * (cols - 2), 0);
+    const std::size_t n = safe_convolve<K>(image.data(), rows, cols, out.data());
+    if(n != out.size())
+        return false;
+    for(std::size_t r = 0; r < rows - 2; ++r)
+        for(std::size_t c = 0; c < cols - 2; ++c)
+            if(out[r * (cols - 2) + c] != reference<K>(image, cols, r, c))
+                return false;
+    return true;
+}
+
+bool test_checked_store(){
+    const std::vector<pixel> image = make_image(rows, cols);
+    std::vector<std::int8_t> out((rows - 2) * (cols - 2), 0);
+    // the results of sobel don't fit in int8_t so storing them is checked
+    try{
+        safe_convolve<sobel>(image.data(), rows, cols, out.data());
+    }
+    catch(const std::system_error &){
+        // but those normalized do
+        safe_convolve<normalized<sobel, 3>>(image.data(), rows, cols, out.data());
+        return true;
+    }
+    return false;
+}
+
+bool test_signed_input(){
+    // a signed input with a wrapping intermediate sum
+    using sample = safe<std::int16_t>;
+    using difference = kernel<1, -1>;
+    const std::vector<sample> v = {
+        std::numeric_limits<std::int16_t>::max(),
+        std::numeric_limits<std::int16_t>::min(),
+        0,
+        std::numeric_limits<std::int16_t>::max()
+    };
+    std::vector<std::int32_t> out(3);
+    safe_convolve<difference>(v.data(), v.size(), out.data());
+    return out[0] == 65535 && out[1] == -32768 && out[2] == -32767;
+}
+
+int main(){
+    std::cout << "test convolution" << std::endl;
+    const bool rval =
+        test_1d()
+        && test_2d<blur, pixel>()
+        && test_2d<sobel, std::int32_t>()
+        && test_2d<sobel, convolution_result_type<sobel, pixel>>()
+        && test_checked_store()
+        && test_signed_input();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
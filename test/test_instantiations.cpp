@@ -0,0 +1,81 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test the library of explicit instantiations.  This program is linked
+// with it so the operations of the common safe types used here are those
+// compiled in the library.
+
+#if ! defined(BOOST_SAFE_NUMERICS_EXTERN_INSTANTIATIONS)
+#error "this test must be linked with boost_safe_numerics_instantiations"
+#endif
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <limits>
+#include <system_error>
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/automatic.hpp>
+#include <boost/safe_numerics/exception_policies.hpp>
+
+using namespace boost::safe_numerics;
+
+// the results of the instantiated operators on safe<T, P, E>
+template<class T, class P, class E>
+bool test_operators(){
+    using safe_t = safe<T, P, E>;
+    const safe_t a = 7;
+    const safe_t b = 3;
+    return a + b == 10
+        && a - b == 4
+        && a * b == 21
+        && a / b == 2
+        && a % b == 1
+        && b < a
+        && ! (a < b)
+        && a == safe_t(7);
+}
+
+template<class T>
+bool test_type(){
+    return test_operators<T, native, default_exception_policy>()
+        && test_operators<T, native, loose_exception_policy>()
+        && test_operators<T, automatic, default_exception_policy>()
+        && test_operators<T, automatic, loose_exception_policy>();
+}
+
+// errors are still detected
+bool test_error(){
+    using safe_t = safe<std::int64_t>;
+    const safe_t a = std::numeric_limits<std::int64_t>::max();
+    try{
+        a + a;
+        return false;
+    }
+    catch(const std::system_error &){}
+    try{
+        a / safe_t(0);
+        return false;
+    }
+    catch(const std::system_error &){}
+    return true;
+}
+
+int main(){
+    bool rval =
+        test_type<std::int8_t>() &&
+        test_type<std::int16_t>() &&
+        test_type<std::int32_t>() &&
+        test_type<std::int64_t>() &&
+        test_type<std::uint8_t>() &&
+        test_type<std::uint16_t>() &&
+        test_type<std::uint32_t>() &&
+        test_type<std::uint64_t>() &&
+        test_error();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
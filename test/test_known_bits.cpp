@@ -0,0 +1,97 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test the narrowing of the results of bitwise operations by the bits
+// known from the ranges of their arguments
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <limits>
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/safe_integer_range.hpp>
+#include <boost/safe_numerics/safe_integer_literal.hpp>
+#include <boost/safe_numerics/safe_congruence.hpp>
+#include <boost/safe_numerics/known_bits.hpp>
+
+using namespace boost::safe_numerics;
+
+// the domain itself
+constexpr const known_bits<std::uint8_t> a(interval<std::uint8_t>(0x30, 0x3f));
+static_assert(a.zeros == 0xc0 && a.ones == 0x30, "interval to bits");
+constexpr const known_bits<std::uint8_t> b(interval<std::uint8_t>(5, 5));
+static_assert(b.zeros == 0xfa && b.ones == 0x05, "value to bits");
+static_assert((a & b).to_interval().l == 0 && (a & b).to_interval().u == 5, "&");
+static_assert((a | b).to_interval().l == 0x35 && (a | b).to_interval().u == 0x3f, "|");
+static_assert((a ^ b).to_interval().l == 0x30 && (a ^ b).to_interval().u == 0x3f, "^");
+
+template<class T>
+constexpr std::intmax_t min_value(){
+    return base_value(std::numeric_limits<T>::min());
+}
+template<class T>
+constexpr std::intmax_t max_value(){
+    return base_value(std::numeric_limits<T>::max());
+}
+
+using byte = safe<std::uint8_t>;
+using mask = safe_unsigned_literal<0xf0>;
+using three = safe_unsigned_literal<3>;
+
+using masked = decltype(byte() & mask());
+using flagged = decltype((byte() & mask()) | three());
+static_assert(min_value<masked>() == 0 && max_value<masked>() == 0xf0, "&");
+static_assert(min_value<flagged>() == 3 && max_value<flagged>() == 0xff, "|");
+
+// the range is narrowed further if the low bits are tracked
+using tracked = safe_congruent<std::uint8_t, 1>;
+using tracked_flagged = decltype((tracked() & mask()) | three());
+static_assert(
+    min_value<tracked_flagged>() == 3 && max_value<tracked_flagged>() == 0xf3,
+    "tracked |"
+);
+
+// packing two nibbles into a byte compiles without any run time checks
+using trap_byte = safe<std::uint8_t, native, loose_trap_policy>;
+trap_byte pack(const trap_byte & lo, const trap_byte & hi){
+    return
+        (lo & safe_unsigned_literal<0x0f>())
+        | ((hi & safe_unsigned_literal<0x0f>()) << safe_unsigned_literal<4>());
+}
+
+// every result of an operation on two ranges lies in the range of its type
+template<class T, class U, class F>
+bool test_sound(F f){
+    for(std::intmax_t i = min_value<T>(); i <= max_value<T>(); ++i)
+    for(std::intmax_t j = min_value<U>(); j <= max_value<U>(); ++j){
+        const auto r = f(T(i), U(j));
+        using r_type = decltype(r);
+        const std::intmax_t x = base_value(r);
+        if(x < min_value<r_type>() || x > max_value<r_type>())
+            return false;
+    }
+    return true;
+}
+
+template<class T, class U>
+bool test_sound(){
+    return
+        test_sound<T, U>([](const T & t, const U & u){ return t & u; })
+        && test_sound<T, U>([](const T & t, const U & u){ return t | u; })
+        && test_sound<T, U>([](const T & t, const U & u){ return t ^ u; });
+}
+
+int main(){
+    std::cout << "test known bits" << std::endl;
+    const bool rval =
+        test_sound<safe_unsigned_range<16, 47>, safe_unsigned_range<5, 9> >()
+        && test_sound<safe_unsigned_range<0, 255>, safe_unsigned_range<64, 127> >()
+        && test_sound<safe_unsigned_range<100, 200>, safe_unsigned_range<3, 3> >()
+        && pack(trap_byte(safe_unsigned_literal<0x1a>()), trap_byte(safe_unsigned_literal<0x2b>())) == 0xba;
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
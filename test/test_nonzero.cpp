@@ -0,0 +1,116 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test safe integers which exclude zero
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/safe_integer_range.hpp>
+#include <boost/safe_numerics/safe_integer_literal.hpp>
+#include <boost/safe_numerics/automatic.hpp>
+#include <boost/safe_numerics/safe_nonzero.hpp>
+
+using namespace boost::safe_numerics;
+
+static_assert(
+    std::numeric_limits<safe_nonzero<unsigned> >::min() == 1
+    && std::numeric_limits<safe_nonzero<int> >::min() == std::numeric_limits<int>::min(),
+    "incorrect range"
+);
+static_assert(excludes_zero<safe_nonzero_range<-10, 10> >::value, "trait");
+static_assert(! excludes_zero<safe_signed_range<-10, 10> >::value, "trait");
+
+// with the trap policy any operation which might fail is a compile time
+// error.  So these functions compile only because division and modulus
+// by a nonzero value need not be checked.
+using trap_dividend = safe_signed_range<-1000, 1000, native, loose_trap_policy>;
+using trap_divisor = safe_nonzero<int, native, loose_trap_policy>;
+
+int divide(const trap_dividend & t, const trap_divisor & u){
+    return t / u;
+}
+int modulus(const trap_dividend & t, const trap_divisor & u){
+    return t % u;
+}
+unsigned divide(
+    const safe<unsigned, automatic, loose_trap_policy> & t,
+    const safe_nonzero<unsigned, automatic, loose_trap_policy> & u
+){
+    return t / u;
+}
+
+bool test_trap(){
+    const trap_dividend t = safe_signed_literal<-999>();
+    const trap_divisor u = safe_signed_literal<7>();
+    const safe<unsigned, automatic, loose_trap_policy> a = safe_unsigned_literal<100>();
+    const safe_nonzero<unsigned, automatic, loose_trap_policy> b =
+        safe_unsigned_literal<7>();
+    return
+        divide(t, u) == -999 / 7
+        && modulus(t, u) == -999 % 7
+        && divide(a, b) == 100u / 7u;
+}
+
+// zero is rejected when the value is constructed or modified
+bool test_validation(){
+    safe_nonzero<int> x = -1;
+    try{
+        ++x;
+        return false;
+    }
+    catch(const std::system_error &){}
+    if(x != -1)
+        return false;
+    try{
+        x = 0;
+        return false;
+    }
+    catch(const std::system_error &){}
+    try{
+        const safe_nonzero_range<-5, 5> y(0);
+        return false;
+    }
+    catch(const std::system_error &){}
+    // as are values outside the range
+    try{
+        const safe_nonzero_range<-5, 5> y(6);
+        return false;
+    }
+    catch(const std::system_error &){}
+    x = 3;
+    x *= 5;
+    return x == 15;
+}
+
+// without a restriction of the dividend INT_MIN / -1 can still overflow
+bool test_overflow(){
+    const safe<int> t = std::numeric_limits<int>::min();
+    const safe_nonzero<int> u = -1;
+    try{
+        t / u;
+    }
+    catch(const std::system_error &){
+        const safe<int> r = (t + 1) / u;
+        return r == std::numeric_limits<int>::max();
+    }
+    return false;
+}
+
+int main(){
+    std::cout << "test nonzero" << std::endl;
+    const bool rval =
+        test_trap()
+        && test_validation()
+        && test_overflow();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,180 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test direct address sets and maps keyed by safe range types
+
+#include <iostream>
+#include <cstdlib> // EXIT_SUCCESS
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <boost/safe_numerics/safe_integer_range.hpp>
+#include <boost/safe_numerics/safe_range_set.hpp>
+#include <boost/safe_numerics/safe_range_map.hpp>
+
+using namespace boost::safe_numerics;
+
+using key_type = safe_unsigned_range<0, 199>;
+using signed_key_type = safe_signed_range<-100, 100>;
+
+bool test_set(){
+    using set_type = safe_range_set<key_type>;
+    static_assert(set_type::capacity() == 200, "wrong capacity");
+    set_type s;
+    if(! s.empty())
+        return false;
+    if(! s.insert(150) || ! s.insert(3) || ! s.insert(64) || s.insert(3))
+        return false;
+    if(s.size() != 3 || ! s.contains(64) || s.contains(63))
+        return false;
+    // iteration is in key order
+    const unsigned int expected[] = {3, 64, 150};
+    unsigned int n = 0;
+    for(const key_type & k : s){
+        if(k != expected[n++])
+            return false;
+    }
+    if(n != 3)
+        return false;
+    if(s.erase(64) != 1 || s.erase(64) != 0 || s.size() != 2)
+        return false;
+    // keys outside the range are rejected on conversion to the key type
+    try{
+        s.insert(200);
+        std::cout << "failed to detect key out of range" << std::endl;
+        return false;
+    }
+    catch(const std::system_error &){}
+    return true;
+}
+
+bool test_signed_set(){
+    using set_type = safe_range_set<signed_key_type>;
+    static_assert(set_type::capacity() == 201, "wrong capacity");
+    set_type s;
+    s.insert(-100);
+    s.insert(0);
+    s.insert(100);
+    auto i = s.begin();
+    if(*i != -100 || *++i != 0 || *++i != 100 || ++i != s.end())
+        return false;
+    if(s.find(1) != s.end() || *s.find(0) != 0)
+        return false;
+    return true;
+}
+
+bool test_set_operations(){
+    using set_type = safe_range_set<key_type>;
+    set_type a, b;
+    for(unsigned int i = 0; i < 200; i += 2)
+        a.insert(i);
+    for(unsigned int i = 0; i < 200; i += 3)
+        b.insert(i);
+    if((a | b).size() != 100 + 67 - 34)
+        return false;
+    if((a & b).size() != 34)
+        return false;
+    if((a - b).size() != 100 - 34)
+        return false;
+    if((a ^ b).size() != 100 + 67 - 2 * 34)
+        return false;
+    if(! (a & b).is_subset_of(a) || a.is_subset_of(b))
+        return false;
+    if(((a - b) | (a & b)) != a)
+        return false;
+    return true;
+}
+
+bool test_map(){
+    using map_type = safe_range_map<signed_key_type, std::string>;
+    map_type m;
+    if(! m.insert(5, "five").second || m.insert(5, "cinq").second)
+        return false;
+    m[-7] = "minus seven";
+    m.emplace(100, 3, 'x');
+    if(m.size() != 3 || m.at(5) != "five" || m[100] != "xxx")
+        return false;
+    m.insert_or_assign(5, "cinq");
+    if(m.at(5) != "cinq")
+        return false;
+    // iteration is in key order
+    const int expected[] = {-7, 5, 100};
+    unsigned int n = 0;
+    for(const auto & kv : m){
+        if(kv.first != expected[n++])
+            return false;
+    }
+    try{
+        m.at(6);
+        return false;
+    }
+    catch(const std::out_of_range &){}
+    // copies are independent
+    map_type m1(m);
+    m1.erase(5);
+    if(m1.size() != 2 || m.size() != 3 || m.find(5) == m.end())
+        return false;
+    map_type m2(std::move(m1));
+    if(m2.size() != 2 || ! m1.empty())
+        return false;
+    m2 = m;
+    if(m2.size() != 3 || (*m2.find(-7)).second != "minus seven")
+        return false;
+    if(m2.keys() != m.keys())
+        return false;
+    m2.clear();
+    return m2.empty();
+}
+
+// a value whose copy throws after a given number of copies
+struct counted {
+    static int live;
+    static int copies_left;
+    counted(){
+        ++live;
+    }
+    counted(const counted &){
+        if(copies_left-- == 0)
+            throw std::runtime_error("copy failed");
+        ++live;
+    }
+    ~counted(){
+        --live;
+    }
+};
+int counted::live = 0;
+int counted::copies_left = 0;
+
+// a copy which fails destroys the values already copied
+bool test_map_copy_failure(){
+    using map_type = safe_range_map<key_type, counted>;
+    {
+        map_type m;
+        for(int k = 0; k < 10; ++k)
+            m[k];
+        counted::copies_left = 4;
+        try{
+            map_type m1(m);
+            return false;
+        }
+        catch(const std::runtime_error &){}
+        if(counted::live != 10)
+            return false;
+    }
+    return counted::live == 0;
+}
+
+int main(){
+    bool rval =
+        test_set() &&
+        test_signed_set() &&
+        test_set_operations() &&
+        test_map() &&
+        test_map_copy_failure();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
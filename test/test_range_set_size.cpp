@@ -0,0 +1,18 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// a set is directly addressed by its key.  This should fail to compile
+// since the range of safe<int> is too large for that.
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/safe_range_set.hpp>
+
+using namespace boost::safe_numerics;
+
+int main(){
+    safe_range_set<safe<int>> s;
+    return s.empty() ? 0 : 1;
+}
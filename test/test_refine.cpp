@@ -0,0 +1,139 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test refinement of values to range types
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/safe_integer_range.hpp>
+#include <boost/safe_numerics/safe_integer_literal.hpp>
+#include <boost/safe_numerics/automatic.hpp>
+#include <boost/safe_numerics/safe_refine.hpp>
+
+using namespace boost::safe_numerics;
+
+// the refined type is the range type with the policies of the original
+static_assert(
+    std::is_same<
+        decltype(*safe_refine<0, 99>(safe<int>())),
+        safe_signed_range<0, 99>
+    >::value,
+    "incorrect refined type"
+);
+static_assert(
+    std::is_same<
+        decltype(*safe_refine<10, 20>(safe<unsigned, automatic>())),
+        safe_unsigned_range<10, 20, automatic>
+    >::value,
+    "incorrect refined type"
+);
+static_assert(
+    std::is_same<
+        decltype(*safe_refine<-5, 5>(std::uint16_t())),
+        safe_signed_range<-5, 5>
+    >::value,
+    "incorrect refined type"
+);
+
+// arithmetic on the refined value is checked against the refined range
+// so the result of x * 3 + 1 is known to be in [1, 298]
+using product_type = decltype(
+    *safe_refine<0, 99>(safe<int>()) * safe_signed_literal<3>()
+        + safe_signed_literal<1>()
+);
+static_assert(
+    std::numeric_limits<product_type>::min() == 1
+    && std::numeric_limits<product_type>::max() == 298,
+    "refined range is not propagated"
+);
+
+// the single compare agrees with two compares for every value of T
+template<class T, std::intmax_t Min, std::intmax_t Max>
+bool test_exhaustive(){
+    for(std::intmax_t i = std::numeric_limits<T>::min();
+        i <= static_cast<std::intmax_t>(std::numeric_limits<T>::max());
+        ++i
+    ){
+        const T t = static_cast<T>(i);
+        const auto r = safe_refine<Min, Max>(t);
+        if(r.has_value() != (Min <= i && i <= Max))
+            return false;
+        if(r && *r != t)
+            return false;
+    }
+    return true;
+}
+
+// values near the limits of wide types
+bool test_extremes(){
+    const std::intmax_t min = std::numeric_limits<std::intmax_t>::min();
+    const std::intmax_t max = std::numeric_limits<std::intmax_t>::max();
+    return
+        safe_refine<min, max>(min).has_value()
+        && safe_refine<min, max>(max).has_value()
+        && ! safe_refine<min, -1>(std::intmax_t(0))
+        && safe_refine<min, -1>(min).has_value()
+        && ! safe_refine<0, max>(std::numeric_limits<std::uintmax_t>::max())
+        && safe_refine<0, max>(static_cast<std::uintmax_t>(max)).has_value()
+        && ! safe_refine<1, 2>(std::numeric_limits<std::uint64_t>::max())
+        // large unsigned values don't alias negative bounds
+        && ! safe_refine<-10, 10>(std::numeric_limits<std::uint64_t>::max())
+        && ! safe_refine<-5, 5>(
+            safe<std::uint64_t>(std::numeric_limits<std::uint64_t>::max() - 3)
+        )
+        && safe_refine<-5, 5>(safe<std::uint64_t>(5)).has_value()
+        && ! safe_refine<min, max>(std::numeric_limits<std::uintmax_t>::max());
+}
+
+bool test_value(){
+    const safe<int> x = 150;
+    const auto r = safe_refine<0, 99>(x);
+    if(r.has_value() || r.value_or(7) != 7)
+        return false;
+    if(refine_or<0, 99>(x, 42) != 42 || refine_or<0, 199>(x, 42) != 150)
+        return false;
+    // an empty refinement is reported by the exception policy
+    try{
+        r.value();
+    }
+    catch(const std::system_error &){
+        // as is a fallback which is out of range
+        try{
+            refine_or<0, 99>(x, 100);
+        }
+        catch(const std::system_error &){
+            return true;
+        }
+    }
+    return false;
+}
+
+// a refinement can be used in a constant expression
+constexpr safe<int> seven = 7;
+static_assert(safe_refine<0, 9>(seven).value() == 7, "constexpr refinement");
+static_assert(! safe_refine<8, 9>(seven), "constexpr refinement");
+
+int main(){
+    std::cout << "test refinement" << std::endl;
+    const bool rval =
+        test_exhaustive<std::int8_t, 0, 99>()
+        && test_exhaustive<std::int8_t, -128, -1>()
+        && test_exhaustive<std::int8_t, -10, 10>()
+        && test_exhaustive<std::uint8_t, 0, 0>()
+        && test_exhaustive<std::uint8_t, -10, 200>()
+        && test_exhaustive<std::int16_t, -1000, 1000>()
+        && test_exhaustive<std::uint16_t, 1000, 65535>()
+        && test_extremes()
+        && test_value();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
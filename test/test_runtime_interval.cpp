@@ -0,0 +1,163 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test run time interval arithmetic against the constexpr operators
+// of interval.hpp applied to checked_result
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <limits>
+#include <vector>
+
+#include <boost/safe_numerics/checked_result.hpp>
+#include <boost/safe_numerics/checked_result_operations.hpp>
+#include <boost/safe_numerics/interval.hpp>
+#include <boost/safe_numerics/runtime_interval.hpp>
+
+using namespace boost::safe_numerics;
+
+template<class T>
+bool same(const checked_result<T> & a, const checked_result<T> & b){
+    if(a.exception() || b.exception())
+        return a.m_e == b.m_e;
+    return static_cast<T>(a) == static_cast<T>(b);
+}
+
+template<class T>
+bool same(
+    const interval<checked_result<T>> & a,
+    const interval<checked_result<T>> & b
+){
+    return same(a.l, b.l) && same(a.u, b.u);
+}
+
+// values near the extremes and around zero
+template<class T>
+std::vector<T> make_values(){
+    using limits = std::numeric_limits<T>;
+    std::vector<T> v = {
+        limits::min(), static_cast<T>(limits::min() + 1),
+        static_cast<T>(limits::min() / 2), static_cast<T>(limits::min() / 3),
+        limits::max(), static_cast<T>(limits::max() - 1),
+        static_cast<T>(limits::max() / 2), static_cast<T>(limits::max() / 3),
+        0, 1, 2, 3, 100
+    };
+    if(limits::is_signed){
+        v.push_back(static_cast<T>(-1));
+        v.push_back(static_cast<T>(-2));
+        v.push_back(static_cast<T>(-100));
+    }
+    return v;
+}
+
+template<class T>
+bool test_scalar(){
+    using r_type = checked_result<T>;
+    using c_interval = interval<r_type>;
+    const std::vector<T> v = make_values<T>();
+    for(const T tl : v) for(const T tu : v){
+        if(tu < tl)
+            continue;
+        const interval<T> t(tl, tu);
+        const c_interval ct{r_type(tl), r_type(tu)};
+        for(const T ul : v) for(const T uu : v){
+            if(uu < ul)
+                continue;
+            const interval<T> u(ul, uu);
+            const c_interval cu{r_type(ul), r_type(uu)};
+            if(! same(runtime_interval::add(t, u), c_interval(ct + cu)))
+                return false;
+            if(! same(runtime_interval::subtract(t, u), c_interval(ct - cu)))
+                return false;
+            if(! same(runtime_interval::multiply(t, u), c_interval(ct * cu)))
+                return false;
+            const interval<checked_result<T>> q = runtime_interval::divide(t, u);
+            if(ul <= 0 && 0 <= uu){
+                if(q.l.m_e != safe_numerics_error::domain_error)
+                    return false;
+            }
+            else
+            if(! same(q, c_interval(ct / cu)))
+                return false;
+        }
+    }
+    return true;
+}
+
+// the batch results are those of the scalar functions with the
+// overflows replaced by the limits of T
+template<class T>
+T saturate(const checked_result<T> & r){
+    if(! r.exception())
+        return static_cast<T>(r);
+    return r.m_e == safe_numerics_error::negative_overflow_error
+        ? std::numeric_limits<T>::min()
+        : std::numeric_limits<T>::max();
+}
+
+template<class T>
+bool test_batch(){
+    const std::vector<T> v = make_values<T>();
+    std::vector<T> tl, tu, ul, uu;
+    for(const T a : v) for(const T b : v) for(const T c : v){
+        if(b < a)
+            continue;
+        tl.push_back(a);
+        tu.push_back(b);
+        ul.push_back(c);
+        uu.push_back(c < 50 ? static_cast<T>(c + 3) : c);
+    }
+    const std::size_t n = tl.size();
+    std::vector<T> rl(n), ru(n);
+    using F = interval<checked_result<T>> (*)(const interval<T> &, const interval<T> &);
+    using B = std::size_t (*)(
+        const std::size_t &,
+        const T *, const T *, const T *, const T *,
+        T *, T *
+    );
+    const F scalar[] = {
+        runtime_interval::add<T>,
+        runtime_interval::subtract<T>,
+        runtime_interval::multiply<T>
+    };
+    const B batch[] = {
+        runtime_interval::add<T>,
+        runtime_interval::subtract<T>,
+        runtime_interval::multiply<T>
+    };
+    for(std::size_t k = 0; k < 3; ++k){
+        const std::size_t overflows = batch[k](
+            n, tl.data(), tu.data(), ul.data(), uu.data(), rl.data(), ru.data()
+        );
+        std::size_t count = 0;
+        for(std::size_t i = 0; i < n; ++i){
+            const interval<checked_result<T>> r = scalar[k](
+                interval<T>(tl[i], tu[i]),
+                interval<T>(ul[i], uu[i])
+            );
+            count += r.l.exception() || r.u.exception();
+            if(rl[i] != saturate(r.l) || ru[i] != saturate(r.u))
+                return false;
+        }
+        if(count != overflows)
+            return false;
+    }
+    return true;
+}
+
+int main(){
+    std::cout << "test run time interval arithmetic" << std::endl;
+    const bool rval =
+        test_scalar<std::int8_t>()
+        && test_scalar<std::int32_t>()
+        && test_scalar<std::int64_t>()
+        && test_scalar<std::uint32_t>()
+        && test_batch<std::int32_t>()
+        && test_batch<std::uint64_t>();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
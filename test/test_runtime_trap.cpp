@@ -0,0 +1,120 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test the runtime trap actions.  Each failing operation is performed in
+// a child process which should be terminated by the trap.
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/exception_policies.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#include <sys/wait.h>
+#include <unistd.h>
+#define BOOST_SAFE_NUMERICS_TEST_FORK
+#endif
+
+using namespace boost::safe_numerics;
+
+using recorded_trap_policy = exception_policy<
+    recorded_trap_exception,
+    recorded_trap_exception,
+    recorded_trap_exception,
+    ignore_exception
+>;
+
+template<class EP>
+using safe_t = safe<std::int8_t, native, EP>;
+
+// operations which don't fail are unaffected
+template<class EP>
+bool test_no_trap(){
+    safe_t<EP> x = 100;
+    x = x + 27;
+    x = x / 2;
+    return x == 63;
+}
+
+#ifdef BOOST_SAFE_NUMERICS_TEST_FORK
+
+// run f in a child process and return its wait status
+template<class F>
+int in_child(F f){
+    std::cout.flush();
+    const pid_t pid = fork();
+    if(pid == 0){
+        f();
+        _exit(EXIT_SUCCESS);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return status;
+}
+
+bool trapped(int status){
+    return WIFSIGNALED(status)
+        && (WTERMSIG(status) == SIGILL
+        || WTERMSIG(status) == SIGTRAP
+        || WTERMSIG(status) == SIGABRT);
+}
+
+volatile std::int8_t operand = 100;
+
+bool test_trap(){
+    return trapped(in_child([]{
+        safe_t<runtime_trap_policy> x = operand;
+        x = x + x;
+    }));
+}
+
+// the handler exits with success only if the context identifies the error
+extern "C" void check_context(int){
+    const runtime_trap_context & c = trap_context();
+    _exit(
+        c.error == safe_numerics_error::positive_overflow_error
+        && c.site != nullptr
+        ? EXIT_SUCCESS : EXIT_FAILURE
+    );
+}
+
+bool test_recorded(){
+    if(trap_context().error != safe_numerics_error::success)
+        return false;
+    const int status = in_child([]{
+        std::signal(SIGILL, check_context);
+        std::signal(SIGTRAP, check_context);
+        std::signal(SIGABRT, check_context);
+        safe_t<recorded_trap_policy> x = operand;
+        x = x * x;
+        _exit(EXIT_FAILURE);
+    });
+    return WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS;
+}
+
+#else
+
+bool test_trap(){
+    return true;
+}
+bool test_recorded(){
+    return true;
+}
+
+#endif
+
+int main(){
+    bool rval =
+        test_no_trap<runtime_trap_policy>() &&
+        test_no_trap<recorded_trap_policy>() &&
+        test_trap() &&
+        test_recorded();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -5,6 +5,7 @@
 // http://www.boost.org/LICENSE_1_0.txt)
 
 #include <iostream>
+#include <limits>
 
 #include <boost/core/demangle.hpp>
 #include <boost/safe_numerics/safe_compare.hpp>
@@ -61,6 +62,17 @@ bool test_safe_compare_impl(
         break;
     }
     }
+    // v1 is in the ranges of T2 bounded below or above by v2
+    const T2 min2 = std::numeric_limits<T2>::min();
+    const T2 max2 = std::numeric_limits<T2>::max();
+    if(safe_compare::in_range(v1, v2, max2)
+    != (expected_result != '<' && safe_compare::less_than_equal(v1, max2)))
+        return false;
+    if(safe_compare::in_range(v1, min2, v2)
+    != (expected_result != '>' && safe_compare::greater_than_equal(v1, min2)))
+        return false;
+    if(safe_compare::in_range(v1, v2, v2) != (expected_result == '='))
+        return false;
     return true;
 }
 
@@ -100,7 +112,7 @@ const char *test_compare_result[boost::mp11::mp_size<test_values>::value] = {
 /*12*/ "=<>>=<>>=<>>=<>>=<<<=<<<=<<<=<<<>",
 /*13*/ ">>>>>>>>>>>>>=>>>>>>>>>>>>>>>=<<>",
 /*14*/ "<<<<<<<<<<<<<<=<<<<<<<<<<<<<<<<<<",
-/*15*/ "<<>=<<>=<<>=<<>=<<<<<<<<<<<<<<<<",
+/*15*/ "<<>=<<>=<<>=<<>=<<<<<<<<<<<<<<<<<",
 
 //      0       0       0       0
 //      012345670123456701234567012345670
@@ -0,0 +1,122 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test serial number arithmetic
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+#include <boost/safe_numerics/safe_serial.hpp>
+
+using namespace boost::safe_numerics;
+
+// examples from RFC 1982 section 3.2 with SERIAL_BITS == 8
+bool test_rfc_examples(){
+    using serial8 = safe_serial<std::uint8_t>;
+    const serial8 s0(0), s1(1), s44(44), s100(100), s200(200), s255(255);
+
+    if(! (s0 < s1 && s0 < s44 && s0 < s100 && s44 < s100 && s100 < s200))
+        return false;
+    if(! (s200 < s255 && s255 < s0 && s255 < s100 && s200 < s0 && s200 < s44))
+        return false;
+    if(s1 < s0 || s255 > s100 || s0 > s44)
+        return false;
+    if(! (s0 <= s0 && s0 >= s0 && s0 == serial8(0) && s0 != s1))
+        return false;
+    return true;
+}
+
+bool test_wrap(){
+    using serial8 = safe_serial<std::uint8_t>;
+    serial8 s(254);
+    const serial8 s_old = s++;
+    if(static_cast<std::uint8_t>(s_old) != 254)
+        return false;
+    ++s;
+    if(static_cast<std::uint8_t>(s) != 0)
+        return false;
+    // addition wraps
+    s += 127;
+    s = s + 127;
+    if(static_cast<std::uint8_t>(s) != 254)
+        return false;
+    if(! (s_old == s))
+        return false;
+    return true;
+}
+
+bool test_distance(){
+    using serial16 = safe_serial<std::uint16_t>;
+    using distance_type = serial16::distance_type;
+    static_assert(
+        std::numeric_limits<distance_type>::max() == 32767,
+        "distance must exclude half the number space"
+    );
+    static_assert(
+        std::numeric_limits<distance_type>::min() == -32767,
+        "distance must exclude half the number space"
+    );
+    const serial16 a(65530), b(10);
+    if(distance(a, b) != 16)
+        return false;
+    if(distance(b, a) != -16)
+        return false;
+    // the distance can be used as an ordinary safe integer
+    const auto d = distance(a, b) * 2;
+    if(d != 32)
+        return false;
+    return true;
+}
+
+bool test_window(){
+    using serial32 = safe_serial<std::uint32_t>;
+    const serial32 a(0), b(0x80000000u);
+    try{
+        const bool r = a < b;
+        std::cout << "failed to detect incomparable serial numbers " << r << std::endl;
+        return false;
+    }
+    catch(const std::system_error & e){
+        if(e.code() != safe_numerics_error::range_error)
+            return false;
+    }
+    try{
+        distance(b, a);
+        std::cout << "failed to detect incomparable serial numbers" << std::endl;
+        return false;
+    }
+    catch(const std::system_error &){}
+
+    // incrementing by half the number space is an error
+    serial32 c(0);
+    try{
+        c += 0x80000000u;
+        std::cout << "failed to detect too large an increment" << std::endl;
+        return false;
+    }
+    catch(const std::system_error &){}
+
+    // loose policies permit the comparison and return an unspecified result
+    using loose_serial32 = safe_serial<std::uint32_t, loose_exception_policy>;
+    const loose_serial32 x(0), y(0x7fffffffu);
+    if(! (x < y))
+        return false;
+    return true;
+}
+
+int main(){
+    bool rval =
+        test_rfc_examples() &&
+        test_wrap() &&
+        test_distance() &&
+        test_window();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,138 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test structure of arrays container of records with safe fields
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/safe_integer_range.hpp>
+#include <boost/safe_numerics/safe_soa.hpp>
+#include <boost/safe_numerics/batch.hpp>
+
+using namespace boost::safe_numerics;
+
+using channel = safe_unsigned_range<0, 255>;
+using offset = safe_signed_range<-1000, 1000>;
+using count = safe<std::int32_t>;
+
+using records = safe_soa<channel, offset, count>;
+
+// each column is stored in the narrowest type
+static_assert(
+    std::is_same<records::stored_type<0>, std::uint8_t>::value
+    && std::is_same<records::stored_type<1>, std::int16_t>::value
+    && std::is_same<records::stored_type<2>, std::int32_t>::value,
+    "incorrect column types"
+);
+
+bool test_rows(){
+    records r;
+    r.push_back(channel(1), offset(-2), count(3));
+    r.push_back(std::make_tuple(channel(4), offset(5), count(-6)));
+    if(r.size() != 2)
+        return false;
+    if(r[0].get<0>() != 1 || r[0].get<1>() != -2 || r[1].get<2>() != -6)
+        return false;
+    // field types are returned
+    const auto x = r[1].get<1>();
+    static_assert(std::is_same<decltype(x), const offset>::value, "incorrect field type");
+
+    // assignment through the proxies
+    r[0].set<1>(999);
+    r[1] = r[0];
+    const records::value_type t = r[1];
+    if(t != std::make_tuple(channel(1), offset(999), count(3)))
+        return false;
+    // out of range values are rejected and the row is unchanged
+    try{
+        r[0].set<1>(1001);
+    }
+    catch(const std::system_error &){
+        const records & cr = r;
+        return cr[0].get<1>() == 999;
+    }
+    return false;
+}
+
+constexpr const std::size_t n = 5000;
+
+bool test_append(){
+    std::vector<int> a(n), b(n);
+    std::vector<std::int16_t> c(n);
+    for(std::size_t i = 0; i < n; ++i){
+        a[i] = static_cast<int>(i % 256);
+        b[i] = static_cast<int>(i % 2001) - 1000;
+        c[i] = static_cast<std::int16_t>(i);
+    }
+    records r;
+    r.append(n, a.data(), b.data(), c.data());
+    if(r.size() != n)
+        return false;
+    for(std::size_t i = 0; i < n; ++i)
+        if(r[i].get<0>() != a[i] || r[i].get<1>() != b[i] || r[i].get<2>() != c[i])
+            return false;
+
+    // a value out of range in the middle of the last column.  Nothing is
+    // appended.
+    b[4321] = 1001;
+    try{
+        r.append(n, a.data(), b.data(), c.data());
+    }
+    catch(const std::system_error &){
+        return
+            r.size() == n
+            && r.column<0>().size() == n
+            && r.column<2>().size() == n;
+    }
+    return false;
+}
+
+struct multiply_add {
+    template<class T>
+    T operator()(const T & a, const T & b, const T & c) const {
+        return a * b + c;
+    }
+};
+
+bool test_columns(){
+    records r;
+    for(int i = 0; i < 3000; ++i)
+        r.push_back(channel(i % 256), offset(i % 1000), count(i));
+    // columns can be passed directly to batch evaluation
+    std::vector<std::int64_t> out(r.size());
+    batch_evaluate(
+        multiply_add(),
+        r.size(),
+        out.data(),
+        r.column<0>().data(),
+        r.column<1>().data(),
+        r.column<2>().data()
+    );
+    for(std::size_t i = 0; i < r.size(); ++i)
+        if(out[i] != static_cast<std::int64_t>((i % 256) * (i % 1000) + i))
+            return false;
+    std::int64_t sum = 0;
+    for(const std::int32_t x : r.column<2>())
+        sum += x;
+    return sum == 2999 * 3000 / 2;
+}
+
+int main(){
+    std::cout << "test structure of arrays" << std::endl;
+    const bool rval =
+        test_rows()
+        && test_append()
+        && test_columns();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,137 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test sorting of sequences keyed by safe range types
+
+#include <iostream>
+#include <algorithm> // stable_sort, is_sorted
+#include <cstddef>   // size_t
+#include <cstdlib>   // EXIT_SUCCESS
+#include <memory>    // allocator
+#include <random>
+#include <vector>
+
+#include <boost/safe_numerics/safe_integer_range.hpp>
+#include <boost/safe_numerics/safe_sort.hpp>
+
+using namespace boost::safe_numerics;
+
+// counting sort
+using small_key = safe_unsigned_range<10, 1000>;
+// radix sort with 3 passes
+using large_key = safe_signed_range<-5000000, 5000000>;
+
+static_assert(sort_detail::plan<small_key>::passes == 2, "wrong number of passes");
+static_assert(sort_detail::plan<large_key>::passes == 3, "wrong number of passes");
+
+template<class KeyT>
+std::vector<KeyT> make_keys(const std::size_t & n, const unsigned int seed){
+    using traits = range_key_traits<KeyT>;
+    std::mt19937 g(seed);
+    std::uniform_int_distribution<typename traits::stored_type> d(traits::min, traits::max);
+    std::vector<KeyT> v;
+    v.reserve(n);
+    for(std::size_t i = 0; i < n; ++i)
+        v.push_back(d(g));
+    return v;
+}
+
+template<class KeyT>
+bool test_keys(const std::size_t & n){
+    std::vector<KeyT> v = make_keys<KeyT>(n, 1);
+    std::vector<KeyT> expected(v);
+    std::stable_sort(expected.begin(), expected.end());
+    std::vector<KeyT> pv(v);
+    safe_sort(v.begin(), v.end());
+    safe_sort(parallel_policy(4, 64), pv.begin(), pv.end());
+    return v == expected && pv == expected;
+}
+
+// records sorted on one field to verify stability
+struct record {
+    large_key m_key;
+    std::size_t m_position;
+};
+
+struct by_key {
+    const large_key & operator()(const record & r) const {
+        return r.m_key;
+    }
+};
+
+bool test_stable(const std::size_t & n){
+    // restrict keys to a few values so that there are many duplicates
+    std::vector<record> v;
+    std::mt19937 g(2);
+    std::uniform_int_distribution<int> d(-3, 3);
+    for(std::size_t i = 0; i < n; ++i)
+        v.push_back(record{d(g) * 1000000, i});
+    const std::vector<record> original(v);
+    std::vector<record> pv(v);
+    auto ordered = [](const record & lhs, const record & rhs){
+        return lhs.m_key < rhs.m_key
+            || (lhs.m_key == rhs.m_key && lhs.m_position < rhs.m_position);
+    };
+    safe_sort(v.begin(), v.end(), by_key());
+    safe_sort(parallel_policy(3, 100), pv.begin(), pv.end(), by_key());
+    if(! std::is_sorted(v.begin(), v.end(), ordered))
+        return false;
+    if(! std::is_sorted(pv.begin(), pv.end(), ordered))
+        return false;
+    // a projection onto a small key uses the counting sort
+    auto by_position = [](const record & r){
+        return safe_unsigned_range<0, 4095>(r.m_position % 4096);
+    };
+    v = original;
+    safe_sort(v.begin(), v.end(), by_position);
+    for(std::size_t i = 1; i < n; ++i){
+        const std::size_t x = v[i - 1].m_position % 4096;
+        const std::size_t y = v[i].m_position % 4096;
+        if(x > y || (x == y && v[i - 1].m_position > v[i].m_position))
+            return false;
+    }
+    return true;
+}
+
+// allocator which counts allocations
+template<class T>
+struct counting_allocator : public std::allocator<T> {
+    static std::size_t m_count;
+    template<class U>
+    struct rebind {
+        using other = counting_allocator<U>;
+    };
+    counting_allocator() = default;
+    template<class U>
+    counting_allocator(const counting_allocator<U> &){}
+    T * allocate(const std::size_t n){
+        ++m_count;
+        return std::allocator<T>::allocate(n);
+    }
+};
+template<class T>
+std::size_t counting_allocator<T>::m_count = 0;
+
+bool test_allocator(){
+    std::vector<large_key> v = make_keys<large_key>(1000, 3);
+    safe_sort(v.begin(), v.end(), sort_identity(), counting_allocator<large_key>());
+    return std::is_sorted(v.begin(), v.end())
+        && counting_allocator<large_key>::m_count == 1
+        && counting_allocator<std::size_t>::m_count > 0;
+}
+
+int main(){
+    bool rval =
+        test_keys<small_key>(0) &&
+        test_keys<small_key>(1) &&
+        test_keys<small_key>(10000) &&
+        test_keys<large_key>(10000) &&
+        test_keys<safe_signed_range<-100, 100>>(1000) &&
+        test_stable(10000) &&
+        test_allocator();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,178 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test Fenwick and segment trees of safe integers
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <exception>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/safe_integer_range.hpp>
+#include <boost/safe_numerics/safe_sum_tree.hpp>
+
+using namespace boost::safe_numerics;
+
+using byte_t = safe_unsigned_range<0, 255>;
+using signed_t = safe_signed_range<-100, 27>;
+using positive_t = safe_unsigned_range<3, 9>;
+
+// the sum types have the bounds of 0 ... N values
+static_assert(
+    std::numeric_limits<safe_fenwick<byte_t, 1000>::sum_type>::max() == 255000,
+    "sum type of bytes"
+);
+static_assert(
+    std::numeric_limits<safe_segment_tree<signed_t, 10>::sum_type>::min() == -1000
+    && std::numeric_limits<safe_segment_tree<signed_t, 10>::sum_type>::max() == 270,
+    "sum type of signed values"
+);
+static_assert(
+    std::numeric_limits<safe_fenwick<positive_t, 7>::sum_type>::min() == 0,
+    "the sum of no values is zero"
+);
+
+// the levels near the leaves are narrower than a 32 bit count
+static_assert(
+    sizeof(safe_fenwick<byte_t, 1024>) < 1024 * 2,
+    "Fenwick tree of bytes"
+);
+static_assert(
+    sizeof(safe_segment_tree<byte_t, 1024>) < 2 * 1024 * 3,
+    "segment tree of bytes"
+);
+
+// compare a tree with a vector after a sequence of pseudo random updates
+template<class Tree>
+bool test_tree(){
+    using T = typename Tree::value_type;
+    constexpr const std::size_t n = Tree::size();
+    const std::intmax_t min = base_value(std::numeric_limits<T>::min());
+    const std::intmax_t max = base_value(std::numeric_limits<T>::max());
+
+    Tree tree;
+    const std::intmax_t initial = min > 0 ? min : max < 0 ? max : 0;
+    std::vector<std::intmax_t> v(n, initial);
+
+    std::uint64_t x = 1;
+    for(std::size_t step = 0; step < 4 * n; ++step){
+        x = x * 6364136223846793005u + 1442695040888963407u;
+        const std::size_t i = (x >> 33) % n;
+        const std::intmax_t value = min + static_cast<std::intmax_t>(
+            (x >> 17) % static_cast<std::uint64_t>(max - min + 1)
+        );
+        tree.set(i, value);
+        v[i] = value;
+        if(tree[i] != value)
+            return false;
+    }
+    std::intmax_t s = 0;
+    for(std::size_t i = 0; i <= n; ++i){
+        if(tree.prefix_sum(i) != s)
+            return false;
+        if(i < n)
+            s += v[i];
+    }
+    for(std::size_t first = 0; first <= n; first += 3){
+        s = 0;
+        for(std::size_t last = first; last <= n; ++last){
+            if(tree.sum(first, last) != s)
+                return false;
+            if(last < n)
+                s += v[last];
+        }
+    }
+    return true;
+}
+
+// every value at its maximum gives the maximum sum
+template<class Tree>
+bool test_extremes(){
+    using T = typename Tree::value_type;
+    Tree tree;
+    for(std::size_t i = 0; i < Tree::size(); ++i)
+        tree.set(i, std::numeric_limits<T>::max());
+    if(tree.prefix_sum(Tree::size())
+    != std::numeric_limits<typename Tree::sum_type>::max())
+        return false;
+    for(std::size_t i = 0; i < Tree::size(); ++i)
+        tree.set(i, std::numeric_limits<T>::min());
+    return tree.sum(0, Tree::size())
+        == static_cast<std::intmax_t>(Tree::size())
+            * base_value(std::numeric_limits<T>::min());
+}
+
+// only the values passed in are checked
+template<class Tree>
+bool test_errors(){
+    Tree tree;
+    try{
+        tree.set(Tree::size(), 1);
+        return false;
+    }
+    catch(const std::exception &){}
+    try{
+        tree.set(0, 256);
+        return false;
+    }
+    catch(const std::exception &){}
+    try{
+        tree.sum(2, 1);
+        return false;
+    }
+    catch(const std::exception &){}
+    return true;
+}
+
+// with values and indices of the tree's types no check is required so
+// this compiles even though any check would be a compile time error
+template<template<class, std::size_t> class Tree>
+bool test_unchecked(){
+    using T = safe_unsigned_range<0, 255, native, loose_trap_policy>;
+    using tree_type = Tree<T, 100>;
+    using index_type = typename tree_type::index_type;
+    using count_type = typename tree_type::count_type;
+    tree_type tree;
+    std::uintmax_t s = 0;
+    for(std::size_t i = 0; i < 100; ++i){
+        tree.set(
+            index_type(i, typename index_type::skip_validation()),
+            T(i * 2 + 1, typename T::skip_validation())
+        );
+        s += i * 2 + 1;
+    }
+    return base_value(
+        tree.prefix_sum(count_type(100, typename count_type::skip_validation()))
+    ) == s;
+}
+
+int main(){
+    bool rval =
+        test_tree<safe_fenwick<byte_t, 1>>() &&
+        test_tree<safe_fenwick<byte_t, 100>>() &&
+        test_tree<safe_fenwick<signed_t, 129>>() &&
+        test_tree<safe_fenwick<positive_t, 64>>() &&
+        test_tree<safe_fenwick<safe<std::int32_t>, 37>>() &&
+        test_tree<safe_segment_tree<byte_t, 1>>() &&
+        test_tree<safe_segment_tree<byte_t, 100>>() &&
+        test_tree<safe_segment_tree<signed_t, 129>>() &&
+        test_tree<safe_segment_tree<positive_t, 64>>() &&
+        test_tree<safe_segment_tree<safe<std::int32_t>, 37>>() &&
+        test_extremes<safe_fenwick<signed_t, 333>>() &&
+        test_extremes<safe_fenwick<safe<std::uint32_t>, 1000>>() &&
+        test_extremes<safe_segment_tree<signed_t, 333>>() &&
+        test_extremes<safe_segment_tree<safe<std::uint32_t>, 1000>>() &&
+        test_errors<safe_fenwick<byte_t, 10>>() &&
+        test_errors<safe_segment_tree<byte_t, 10>>() &&
+        test_unchecked<safe_fenwick>() &&
+        test_unchecked<safe_segment_tree>();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,83 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test dispatch on the values of safe range types
+
+#include <iostream>
+#include <cstdlib> // EXIT_SUCCESS
+#include <string>
+
+#include <boost/safe_numerics/safe_integer_range.hpp>
+#include <boost/safe_numerics/safe_switch.hpp>
+
+using namespace boost::safe_numerics;
+
+using opcode = safe_unsigned_range<0, 3>;
+
+bool test_visit(){
+    int accumulator = 10;
+    // handlers may ignore the value
+    auto execute = [&](const opcode & op){
+        safe_visit(op,
+            [&]{ accumulator += 1; },
+            [&]{ accumulator -= 1; },
+            [&]{ accumulator *= 2; },
+            [&]{ accumulator = 0; }
+        );
+    };
+    execute(0);  // 11
+    execute(2);  // 22
+    execute(1);  // 21
+    if(accumulator != 21)
+        return false;
+    execute(3);
+    if(accumulator != 0)
+        return false;
+
+    // or receive it as a compile time constant
+    using digit = safe_signed_range<-1, 1>;
+    for(int i = -1; i <= 1; ++i){
+        const std::string s = safe_visit(digit(i),
+            [](std::integral_constant<signed char, -1>){ return "minus"; },
+            [](auto c){ static_assert(c == 0, "wrong value"); return "zero"; },
+            [](auto c){ return std::string(c, '+'); }
+        );
+        if(s != (i < 0 ? "minus" : i == 0 ? "zero" : "+"))
+            return false;
+    }
+    return true;
+}
+
+bool test_switch(){
+    using exponent = safe_unsigned_range<0, 10>;
+    for(unsigned int i = 0; i <= 10; ++i){
+        // the value is available in constant expressions
+        const unsigned int r = safe_switch(exponent(i), [](auto c){
+            constexpr unsigned int p = 1u << c;
+            return p;
+        });
+        if(r != 1u << i)
+            return false;
+    }
+    // negative ranges
+    using delta = safe_signed_range<-100, 100>;
+    for(int i = -100; i <= 100; ++i){
+        const long r = safe_switch(delta(i), [](auto c){
+            return static_cast<long>(c) * 3;
+        });
+        if(r != i * 3)
+            return false;
+    }
+    return true;
+}
+
+int main(){
+    bool rval =
+        test_visit() &&
+        test_switch();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,23 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// safe_visit requires a handler for every value of the type.  This
+// should fail to compile since there is no handler for the value 3.
+
+#include <boost/safe_numerics/safe_integer_range.hpp>
+#include <boost/safe_numerics/safe_switch.hpp>
+
+using namespace boost::safe_numerics;
+
+int main(){
+    using opcode = safe_unsigned_range<0, 3>;
+    const opcode op = 2;
+    return safe_visit(op,
+        []{ return 0; },
+        []{ return 1; },
+        []{ return 2; }
+    );
+}
@@ -0,0 +1,122 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test parallel checked transform
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/safe_transform.hpp>
+
+using namespace boost::safe_numerics;
+
+constexpr const std::size_t n = 100000;
+
+struct multiply {
+    template<class T, class U>
+    auto operator()(const T & t, const U & u) const {
+        return t * u;
+    }
+};
+
+bool test_result(){
+    std::vector<std::int32_t> a(n), b(n);
+    for(std::size_t i = 0; i < n; ++i){
+        a[i] = static_cast<std::int32_t>(i % 40000);
+        b[i] = static_cast<std::int32_t>(i % 50000) - 25000;
+    }
+    std::vector<safe<std::int32_t>> r(n, 0);
+    const std::size_t index = safe_transform(
+        parallel_policy(4, 1000), multiply(), n, r.begin(), a.begin(), b.begin()
+    );
+    if(index != n)
+        return false;
+    for(std::size_t i = 0; i < n; ++i)
+        if(r[i] != a[i] * b[i])
+            return false;
+    // serial version
+    std::vector<safe<std::int32_t>> rs(n, 0);
+    safe_transform(multiply(), n, rs.begin(), a.begin(), b.begin());
+    return rs == r;
+}
+
+bool test_first_error(){
+    std::vector<std::int32_t> a(n, 2), b(n, 3);
+    // provoke failures at several places.  The lowest must always
+    // be the one reported.
+    const std::size_t failures[] = {77777, 31415, 99999, 31416, 50000};
+    for(std::size_t f : failures)
+        a[f] = std::numeric_limits<std::int32_t>::max();
+    std::vector<std::int32_t> r(n, 0);
+    for(unsigned int threads = 1; threads <= 8; threads *= 2){
+        for(int trial = 0; trial < 5; ++trial){
+            try{
+                safe_transform(
+                    parallel_policy(threads, 500),
+                    multiply(), n, r.data(), a.data(), b.data()
+                );
+                std::cout << "failed to detect overflow" << std::endl;
+                return false;
+            }
+            catch(const std::system_error & e){
+                if(e.code() != safe_numerics_error::positive_overflow_error)
+                    return false;
+                if(std::string(e.what()).find("element 31415:") == std::string::npos){
+                    std::cout << e.what() << std::endl;
+                    return false;
+                }
+            }
+        }
+    }
+    // with a policy which ignores errors the index is returned
+    using ignore_policy = exception_policy<
+        ignore_exception, ignore_exception, ignore_exception, ignore_exception
+    >;
+    const std::size_t index = safe_transform<ignore_policy>(
+        parallel_policy(4, 500), multiply(), n, r.data(), a.data(), b.data()
+    );
+    if(index != 31415)
+        return false;
+    // all elements before the failing one are written
+    for(std::size_t i = 0; i < index; ++i)
+        if(r[i] != 6)
+            return false;
+    return true;
+}
+
+// exceptions which don't come from safe numerics are passed through
+bool test_other_exception(){
+    std::vector<std::int32_t> a(n, 1), r(n);
+    try{
+        safe_transform(
+            parallel_policy(4, 500),
+            [](const safe<std::int32_t> & x) -> safe<std::int32_t> {
+                throw std::logic_error("other");
+                return x;
+            },
+            n, r.data(), a.data()
+        );
+        return false;
+    }
+    catch(const std::logic_error &){}
+    return true;
+}
+
+int main(){
+    bool rval =
+        test_result() &&
+        test_first_error() &&
+        test_other_exception();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,156 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test uniform generation of range types
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/safe_integer_range.hpp>
+#include <boost/safe_numerics/safe_uniform.hpp>
+
+using namespace boost::safe_numerics;
+
+using die_t = safe_unsigned_range<1, 6>;
+using small_t = safe_signed_range<-1000, 999>;
+using large_t = safe_signed_range<-3000000000LL, 5000000000LL>;
+
+// every result is in range and has the type of the range
+template<class T, class URBG>
+bool test_range(URBG & g, const std::size_t & n){
+    safe_uniform<T> u;
+    static_assert(
+        std::is_same<decltype(u(g)), T>::value,
+        "the result has the range type"
+    );
+    for(std::size_t i = 0; i < n; ++i){
+        const T x = u(g);
+        if(x < u.min() || x > u.max())
+            return false;
+    }
+    return true;
+}
+
+// a chi square test of the counts of the faces of a die.  With 5
+// degrees of freedom the statistic exceeds 20.5 with probability 0.001.
+template<class URBG>
+bool test_uniformity(URBG & g){
+    constexpr const std::size_t n = 600000;
+    safe_uniform<die_t> u;
+    std::size_t counts[6] = {0};
+    for(std::size_t i = 0; i < n; ++i)
+        ++counts[base_value(u(g)) - 1];
+    double chi2 = 0;
+    for(std::size_t c : counts){
+        const double d = static_cast<double>(c) - n / 6.0;
+        chi2 += d * d / (n / 6.0);
+    }
+    return chi2 < 20.5;
+}
+
+// a range which needs 64 bit words
+bool test_large(){
+    std::mt19937 g32(7);
+    std::mt19937_64 g64(7);
+    if(! test_range<large_t>(g32, 10000) || ! test_range<large_t>(g64, 10000))
+        return false;
+    // both halves of the range are reached
+    safe_uniform<large_t> u;
+    bool below = false, above = false;
+    for(std::size_t i = 0; i < 1000; ++i){
+        const large_t x = u(g64);
+        below |= x < 0;
+        above |= x > 3000000000LL;
+    }
+    return below && above;
+}
+
+// ranges with 2^32 and 2^64 values use the words directly
+bool test_full(){
+    std::mt19937_64 g(11);
+    safe_uniform<safe<std::uint32_t>> u32;
+    safe_uniform<safe<std::int64_t>> i64;
+    bool high = false, negative = false;
+    for(std::size_t i = 0; i < 1000; ++i){
+        high |= u32(g) > 0x80000000u;
+        negative |= i64(g) < 0;
+    }
+    return high && negative;
+}
+
+template<class T>
+bool test_generate(){
+    using stored_type = typename safe_uniform<T>::stored_type;
+    constexpr const std::size_t n = 10000;
+    std::vector<stored_type> whole(n), parts(n);
+
+    counter_engine g(12345);
+    safe_uniform<T>::generate(whole.data(), n, g);
+    if(g.counter() != n)
+        return false;
+    for(stored_type x : whole)
+        if(x < base_value(safe_uniform<T>::min())
+        || x > base_value(safe_uniform<T>::max()))
+            return false;
+
+    // the values don't depend on how the array is divided
+    counter_engine h(12345);
+    std::size_t i = 0;
+    for(std::size_t m = 1; i < n; m = m * 3 + 1){
+        const std::size_t k = std::min(m, n - i);
+        safe_uniform<T>::generate(parts.data() + i, k, h);
+        i += k;
+    }
+    if(whole != parts)
+        return false;
+
+    // a different seed gives different values
+    counter_engine f(54321);
+    safe_uniform<T>::generate(parts.data(), n, f);
+    return whole != parts;
+}
+
+// every value of a small range is generated
+bool test_generate_all(){
+    std::vector<std::int16_t> out(100000);
+    counter_engine g(3);
+    safe_uniform<small_t>::generate(out.data(), out.size(), g);
+    std::vector<bool> seen(2000, false);
+    for(std::int16_t x : out)
+        seen[x + 1000] = true;
+    for(bool b : seen)
+        if(! b)
+            return false;
+    return true;
+}
+
+int main(){
+    std::mt19937 g32(1);
+    std::mt19937_64 g64(1);
+    counter_engine c(1);
+    bool rval =
+        test_range<die_t>(g32, 10000) &&
+        test_range<die_t>(g64, 10000) &&
+        test_range<small_t>(c, 10000) &&
+        test_uniformity(g32) &&
+        test_uniformity(g64) &&
+        test_uniformity(c) &&
+        test_large() &&
+        test_full() &&
+        test_generate<die_t>() &&
+        test_generate<small_t>() &&
+        test_generate<large_t>() &&
+        test_generate<safe<std::int64_t>>() &&
+        test_generate_all();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,122 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test exhaustive verification of functions of small safe integers
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <stdexcept>
+#include <tuple>
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/safe_integer_range.hpp>
+#include <boost/safe_numerics/safe_verify.hpp>
+
+using namespace boost::safe_numerics;
+
+using u8 = safe<std::uint8_t>;
+
+// sum of two bytes stored in a byte.  Fails when x + y > 255
+struct add_bytes {
+    template<class T>
+    void operator()(const T & x, const T & y) const {
+        const T z = x + y;
+        (void)z;
+    }
+};
+
+// number of pairs of bytes whose sum exceeds 255
+constexpr const std::uintmax_t add_failures = 256 * 255 / 2;
+
+bool test_throwing(){
+    const auto r = safe_verify<u8, u8>(add_bytes());
+    if(r.m_domain_size != 65536 || r.m_cases != 65536)
+        return false;
+    if(r.m_failures != add_failures || r.passed())
+        return false;
+    if(r.coverage() != 1.0)
+        return false;
+    if(r.m_failing.size() != 1000)
+        return false;
+    // failures are reported in order with the last argument varying
+    // fastest. The first is 1 + 255
+    const auto & f = r.m_failing.front();
+    return
+        std::get<0>(f.m_arguments) == 1
+        && std::get<1>(f.m_arguments) == 255
+        && f.m_error == safe_numerics_error::positive_overflow_error;
+}
+
+using sticky_u8 = safe<std::uint8_t, native, sticky_exception_policy>;
+
+bool test_sticky(){
+    // the same function with errors recorded rather than thrown
+    const auto r = safe_verify<sticky_u8, sticky_u8>(add_bytes(), 10);
+    if(r.m_failures != add_failures || r.m_failing.size() != 10)
+        return false;
+    for(const auto & f : r.m_failing)
+        if(std::get<0>(f.m_arguments) + std::get<1>(f.m_arguments) <= 255)
+            return false;
+    return true;
+}
+
+bool test_parallel(){
+    const auto s = safe_verify<u8, u8>(add_bytes(), 100000);
+    const auto p = safe_verify<u8, u8>(parallel_policy(4, 1000), add_bytes(), 100000);
+    if(p.m_failures != s.m_failures
+    || p.m_failing.size() != s.m_failing.size())
+        return false;
+    for(std::size_t i = 0; i < s.m_failing.size(); ++i)
+        if(p.m_failing[i].m_arguments != s.m_failing[i].m_arguments)
+            return false;
+    return true;
+}
+
+// a controller calculation on ranges which can't fail
+using speed = safe_unsigned_range<0, 1000>;
+using gain = safe_signed_range<-16, 16>;
+using offset = safe_signed_range<-100, 100>;
+
+bool test_passing(){
+    const auto r = safe_verify<speed, gain, offset>(
+        parallel_policy(2),
+        [](const speed & s, const gain & g, const offset & o){
+            const safe<std::int16_t> u = s * g + o;
+            (void)u;
+        }
+    );
+    return
+        r.passed()
+        && r.m_domain_size == std::uintmax_t(1001) * 33 * 201
+        && r.m_failing.empty()
+        && r.throughput() > 0;
+}
+
+bool test_other_exception(){
+    try{
+        safe_verify<u8>([](const u8 & x){
+            if(x == 200)
+                throw std::logic_error("not a safe numerics error");
+        });
+    }
+    catch(const std::logic_error &){
+        return true;
+    }
+    return false;
+}
+
+int main(){
+    std::cout << "test exhaustive verification" << std::endl;
+    const bool rval =
+        test_throwing()
+        && test_sticky()
+        && test_parallel()
+        && test_passing()
+        && test_other_exception();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
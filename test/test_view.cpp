@@ -0,0 +1,160 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test lazy views of ranges of integers as safe types
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <list>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+#if defined(__cpp_lib_ranges)
+#include <ranges>
+#endif
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/safe_integer_range.hpp>
+#include <boost/safe_numerics/safe_view.hpp>
+
+using namespace boost::safe_numerics;
+
+using byte_t = safe_unsigned_range<0, 255>;
+using sticky_t = safe_unsigned_range<0, 255, native, sticky_exception_policy>;
+
+// every value is yielded in order with the type of the view
+template<class S, class R>
+bool test_values(R & r){
+    std::size_t n = 0;
+    auto i = std::begin(r);
+    for(auto s : r | views::safe_cast<S>){
+        static_assert(std::is_same<decltype(s), S>::value, "type of view");
+        if(s != *i++)
+            return false;
+        ++n;
+    }
+    return n == static_cast<std::size_t>(std::distance(std::begin(r), std::end(r)));
+}
+
+// the values before the first invalid one are yielded and the error
+// message gives its position
+template<class R>
+bool test_error(const std::size_t & n, const std::size_t & position, int value){
+    R r;
+    for(std::size_t i = 0; i < n; ++i)
+        r.push_back(i == position ? value : static_cast<int>(i % 256));
+    std::size_t yielded = 0;
+    try{
+        for(const byte_t & s : r | views::safe_cast<byte_t>){
+            (void)s;
+            ++yielded;
+        }
+    }
+    catch(const std::system_error & e){
+        const std::string what = e.what();
+        return yielded == position
+            && what.find("element " + std::to_string(position) + " ") != std::string::npos
+            && e.code() == (value < 0
+                ? safe_numerics_error::negative_overflow_error
+                : safe_numerics_error::positive_overflow_error);
+    }
+    return false;
+}
+
+// with a policy which doesn't throw the invalid values are reported and
+// skipped and the valid ones are yielded in order
+template<class R>
+bool test_sticky(){
+    R r(200, 7);
+    std::size_t i = 0;
+    for(auto & x : r){
+        if(i == 0 || i == 70 || i == 71)
+            x = 300;
+        else
+        if(i == 199)
+            x = -1;
+        else
+            x = static_cast<int>(i % 256);
+        ++i;
+    }
+    sticky_exception::clear();
+    std::size_t n = 0;
+    int previous = 0;
+    for(const sticky_t & s : r | views::safe_cast<sticky_t>){
+        const int x = base_value(s);
+        if(x < 1 || x > 198 || x <= previous)
+            return false;
+        previous = x;
+        ++n;
+    }
+    return n == 196
+        && sticky_exception::error() == safe_numerics_error::positive_overflow_error;
+}
+
+// a range which is an rvalue is owned by the view
+bool test_rvalue(const std::vector<int> & v){
+    std::size_t n = 0;
+    for(const byte_t & s : std::vector<int>(v) | views::safe_cast<byte_t>)
+        if(s != v[n++])
+            return false;
+    return n == v.size();
+}
+
+#if defined(__cpp_lib_ranges)
+// the view composes with the views of the standard library
+bool test_pipeline(const std::vector<int> & v){
+    std::size_t n = 0;
+    const auto f = [](int i){
+        return i / 2;
+    };
+    for(const byte_t & s : v | std::views::transform(f) | views::safe_cast<byte_t>)
+        if(s != f(v[n++]))
+            return false;
+    return n == v.size();
+}
+#endif
+
+int main(){
+    std::vector<int> empty;
+    std::vector<int> v(1000);
+    for(std::size_t i = 0; i < v.size(); ++i)
+        v[i] = static_cast<int>((i * 37) % 256);
+    const std::list<std::uint8_t> l(v.begin(), v.end());
+    const std::int8_t a[] = {-128, -1, 0, 1, 127};
+
+    bool rval =
+        test_values<byte_t>(empty) &&
+        test_values<byte_t>(v) &&
+        test_values<byte_t>(l) &&
+        test_values<safe<int>>(a) &&
+        test_values<safe_signed_range<-128, 127>>(a) &&
+        test_error<std::vector<int>>(1, 0, 256) &&
+        test_error<std::vector<int>>(64, 0, -1) &&
+        test_error<std::vector<int>>(64, 63, 1000) &&
+        test_error<std::vector<int>>(65, 64, -5) &&
+        test_error<std::vector<int>>(1000, 555, 256) &&
+        test_error<std::list<int>>(1, 0, 256) &&
+        test_error<std::list<int>>(64, 0, -1) &&
+        test_error<std::list<int>>(64, 63, 1000) &&
+        test_error<std::list<int>>(65, 64, -5) &&
+        test_error<std::list<int>>(1000, 555, 256) &&
+        test_sticky<std::vector<int>>() &&
+        test_sticky<std::list<int>>() &&
+        test_rvalue(v);
+    #if defined(__cpp_lib_ranges)
+    rval = rval && test_pipeline(v);
+    #endif
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}
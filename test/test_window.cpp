@@ -0,0 +1,170 @@
+//  Copyright (c) 2026 Robert Ramey
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// test sliding window aggregates
+
+#include <iostream>
+#include <algorithm> // min_element, max_element
+#include <cstdint>
+#include <cstdlib> // EXIT_SUCCESS
+#include <limits>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <boost/safe_numerics/safe_integer.hpp>
+#include <boost/safe_numerics/safe_integer_range.hpp>
+#include <boost/safe_numerics/safe_window.hpp>
+
+using namespace boost::safe_numerics;
+
+using sample = safe<std::int32_t>;
+constexpr const std::size_t W = 100;
+
+// the sum type has exactly the range of W samples and is just wide
+// enough to hold it
+static_assert(
+    std::numeric_limits<safe_window_sum<sample, W>::sum_type>::max()
+    == std::intmax_t(std::numeric_limits<std::int32_t>::max()) * W,
+    "incorrect range of sum"
+);
+static_assert(
+    std::is_same<
+        base_type<safe_window_sum<sample, W>::sum_type>::type,
+        std::int64_t
+    >::value,
+    "incorrect width of sum"
+);
+using level = safe_unsigned_range<0, 1000>;
+static_assert(
+    std::is_same<
+        base_type<safe_window_sum<level, 16>::sum_type>::type,
+        std::uint16_t
+    >::value,
+    "incorrect width of sum"
+);
+
+// values in [-1000000, 1000000] with extremes to make the running sum
+// wrap around in its accumulator
+std::vector<sample> make_samples(const std::size_t & n){
+    std::vector<sample> v;
+    std::uint32_t x = 12345;
+    for(std::size_t i = 0; i < n; ++i){
+        x = x * 1103515245u + 12345u;
+        if(i % 97 < 10)
+            v.push_back(std::numeric_limits<std::int32_t>::max());
+        else
+        if(i % 89 < 10)
+            v.push_back(std::numeric_limits<std::int32_t>::min());
+        else
+            v.push_back(static_cast<std::int32_t>(x % 2000001) - 1000000);
+    }
+    return v;
+}
+
+std::int64_t reference_sum(
+    const std::vector<sample> & v,
+    const std::size_t & end
+){
+    std::int64_t s = 0;
+    for(std::size_t i = end > W ? end - W : 0; i < end; ++i)
+        s += base_value(v[i]);
+    return s;
+}
+
+bool test_sum(){
+    const std::vector<sample> v = make_samples(1000);
+    safe_window_sum<sample, W> w;
+    if(! w.empty())
+        return false;
+    for(std::size_t i = 0; i < v.size(); ++i){
+        w.push(v[i]);
+        if(w.size() != std::min(i + 1, W))
+            return false;
+        if(w.sum() != reference_sum(v, i + 1))
+            return false;
+        if(w.mean() != reference_sum(v, i + 1) / std::int64_t(w.size()))
+            return false;
+    }
+    return w.full();
+}
+
+bool test_batched(){
+    const std::vector<sample> v = make_samples(1000);
+    // batches of various sizes including ones larger than the window
+    const std::size_t sizes[] = {1, 7, 33, 99, 100, 101, 250};
+    for(const std::size_t size : sizes){
+        safe_window_sum<sample, W> w;
+        for(std::size_t i = 0; i < v.size(); i += size){
+            const std::size_t n = std::min(size, v.size() - i);
+            w.push(v.data() + i, n);
+            if(w.sum() != reference_sum(v, i + n))
+                return false;
+        }
+    }
+    return true;
+}
+
+bool test_narrowing(){
+    safe_window_sum<sample, 4> w;
+    for(int i = 0; i < 4; ++i)
+        w.push(std::numeric_limits<std::int32_t>::max());
+    // the sum is correct but won't fit in the user's result type
+    try{
+        const safe<std::int32_t> s = w.sum();
+        (void)s;
+    }
+    catch(const std::system_error &){
+        const safe<std::int64_t> s = w.sum();
+        return s == std::int64_t(std::numeric_limits<std::int32_t>::max()) * 4;
+    }
+    return false;
+}
+
+bool test_extremes(){
+    const std::vector<sample> v = make_samples(1000);
+    safe_window_min<sample, W> wmin;
+    safe_window_max<sample, W> wmax;
+    for(std::size_t i = 0; i < v.size(); ++i){
+        wmin.push(v[i]);
+        wmax.push(v[i]);
+        const auto first = v.begin() + (i + 1 > W ? i + 1 - W : 0);
+        const auto last = v.begin() + i + 1;
+        if(wmin.min() != *std::min_element(first, last))
+            return false;
+        if(wmax.max() != *std::max_element(first, last))
+            return false;
+    }
+    // batched
+    safe_window_max<sample, W> b;
+    b.push(v.data(), 150);
+    b.push(v.data() + 150, 30);
+    return
+        b.size() == W
+        && b.max() == *std::max_element(v.begin() + 80, v.begin() + 180);
+}
+
+bool test_range(){
+    // the mean of a range type has the same range
+    safe_window_sum<level, 16> w;
+    for(unsigned int i = 0; i < 40; ++i)
+        w.push(static_cast<std::uint16_t>(i * 25));
+    const level m = w.mean();
+    // mean of 24 ... 39 times 25
+    return m == (24 + 39) * 25 / 2 && w.sum() == (24 + 39) * 8 * 25;
+}
+
+int main(){
+    std::cout << "test sliding window aggregates" << std::endl;
+    const bool rval =
+        test_sum()
+        && test_batched()
+        && test_narrowing()
+        && test_extremes()
+        && test_range();
+    std::cout << (rval ? "success!" : "failure") << std::endl;
+    return rval ? EXIT_SUCCESS : EXIT_FAILURE;
+}